@@ -22,6 +22,20 @@ format_time(struct timespec start, struct timespec end, char buf[256])
 		snprintf(buf, 256, "%.3F secs", diff_us / 1000000.0);
 }
 
+typedef struct
+{
+	int value;
+	size_t pos;
+} input_t;
+
+static int
+cmp_input(const void* x, const void* y)
+{
+	const int a = ((const input_t*)x)->value;
+	const int b = ((const input_t*)y)->value;
+	return (a > b) - (a < b);
+}
+
 static int random_state = 2043930778; // Fixed for reproducibility
 static inline uint32_t
 random_int(uint32_t* state)
@@ -39,13 +53,53 @@ generate(state_t* state, uint32_t* random_state, size_t num)
 {
 }
 
+/* Print the average cost of every operation, on stacks holding `num` values each */
+static void
+bench_ops(size_t num)
+{
+	// Each operation is followed by its inverse to keep the stacks' sizes stable
+	static const enum stack_op pairs[][2] = {
+		{ STACK_OP_SA, STACK_OP_SA },   { STACK_OP_SB, STACK_OP_SB },
+		{ STACK_OP_SS, STACK_OP_SS },   { STACK_OP_PA, STACK_OP_PB },
+		{ STACK_OP_PB, STACK_OP_PA },   { STACK_OP_RA, STACK_OP_RRA },
+		{ STACK_OP_RB, STACK_OP_RRB },  { STACK_OP_RR, STACK_OP_RRR },
+		{ STACK_OP_RRA, STACK_OP_RA },  { STACK_OP_RRB, STACK_OP_RB },
+		{ STACK_OP_RRR, STACK_OP_RR },
+	};
+	const size_t iters = 10000000;
+
+	state_t init = state_new(2 * num);
+	for (size_t i = 0; i < 2 * num; ++i)
+		stack_append(&init.sa, (value_t)i);
+	state_t state = state_clone(&init);
+	state_destroy(&init);
+	for (size_t i = 0; i < num; ++i)
+		state_op(&state, STACK_OP_PB);
+
+	for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); ++i) {
+		struct timespec start, end;
+		clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+		for (size_t j = 0; j < iters; ++j) {
+			state_op(&state, pairs[i][0]);
+			state_op(&state, pairs[i][1]);
+		}
+		clock_gettime(CLOCK_MONOTONIC_RAW, &end);
+		const double ns = (double)(end.tv_sec - start.tv_sec) * 1e9 +
+		                  (double)(end.tv_nsec - start.tv_nsec);
+		printf("%-3s %.2f ns/op\n", op_name(pairs[i][0]), ns / (double)(2 * iters));
+	}
+	state_destroy(&state);
+}
+
 typedef struct
 {
 	uint32_t random_state;
+	size_t bench;
 	size_t generate;
 	int list;
 	const char* method;
 	size_t plot[2];
+	const char* pdb;
 } options_t;
 
 static void
@@ -65,6 +119,7 @@ print_help(const char* program)
 	  "Commands:\n"
 	  "	generate|gen NUM	Generate a random list from a seed\n"
 	  "	list VALUES		Sort the list provided in arguments\n"
+	  "	bench NUM		Measure the cost of every operation on stacks of NUM values\n"
 	  "\n"
 	  "Options:\n"
 	  "	-s, --seed NUM		Use a specific seed for `generate'\n"
@@ -72,6 +127,7 @@ print_help(const char* program)
 	  "		- 'nm', 'Nelder-Mead': (default)\n"
 	  "		- 'poly', 'Polynomial approximation'\n"
 	  "	-p, --plot DEPTH SIZE	Output a plot for every block at depth DEPTH of size SIZE\n"
+	  "	-d, --pdb FILE		Solve small blocks exactly with the pattern database FILE\n"
 	  "",
 	  program);
 }
@@ -87,10 +143,12 @@ main(int ac, char** av)
 	// Parse arguments
 	options_t opts = {
 		.random_state = 2043930778,
+		.bench = 0,
 		.generate = 0,
 		.list = 0,
 		.method = "nm",
 		.plot = { SIZE_MAX, SIZE_MAX },
+		.pdb = NULL,
 	};
 	for (int i = 1; i < ac;) {
 		// Show help
@@ -152,6 +210,15 @@ main(int ac, char** av)
 
 			i += 3;
 		}
+		// Pattern database
+		else if (!strcmp(av[i], "-d") || !strcmp(av[i], "--pdb")) {
+			if (i + 1 >= ac) {
+				fprintf(stderr, "Expected a file after `%s'\n", av[i]);
+				exit(1);
+			}
+			opts.pdb = av[i + 1];
+			i += 2;
+		}
 		// Generate
 		else if (!strcmp(av[i], "gen") || !strcmp(av[i], "generate")) {
 			if (i + 1 >= ac) {
@@ -170,6 +237,24 @@ main(int ac, char** av)
 				exit(1);
 			}
 		}
+		// Benchmark operations
+		else if (!strcmp(av[i], "bench")) {
+			if (i + 1 >= ac) {
+				fprintf(stderr, "Expected an integer after `bench'\n");
+				exit(1);
+			}
+			char* end;
+			opts.bench = strtoul(av[i + 1], &end, 10);
+			if (*end || opts.bench < 2) {
+				fprintf(stderr, "Invalid integer after `bench'\n");
+				exit(1);
+			}
+			i += 2;
+			if (i < ac) {
+				fprintf(stderr, "Unexpected arguments after `bench'\n");
+				exit(1);
+			}
+		}
 		// Read list
 		else if (!strcmp(av[i], "list")) {
 			opts.list = i + 1;
@@ -180,35 +265,69 @@ main(int ac, char** av)
 		}
 	}
 
+	// Only load the database asked for, so that results do not depend on the directory
+	if (opts.pdb) {
+		if (!blk_pdb_load(opts.pdb)) {
+			fprintf(stderr, "Cannot load the pattern database `%s'\n", opts.pdb);
+			exit(1);
+		}
+		fprintf(stderr, "Using the pattern database `%s'\n", opts.pdb);
+	}
+
+	if (opts.bench) {
+		bench_ops(opts.bench);
+		return 0;
+	}
+
 	// Build state
 	const size_t state_capacity = opts.list ? (size_t)(ac - opts.list) : opts.generate;
+	if (state_capacity > (size_t)VALUE_MAX) {
+		fprintf(stderr,
+		        "Cannot sort more than %zu values, rebuild without "
+		        "`-DPUSH_META_NARROW_VALUES=ON'\n",
+		        (size_t)VALUE_MAX);
+		exit(1);
+	}
 	state_t state = state_new(state_capacity);
 	if (opts.list) {
-		for (int i = opts.list; i < ac; ++i) {
+		// Only the relative order matters, store ranks in [0, N)
+		input_t* input = xmalloc(sizeof(input_t) * state_capacity);
+		for (size_t i = 0; i < state_capacity; ++i) {
 			char* end;
-			const int val = (int)strtol(av[i], &end, 10);
-			for (size_t j = 0; j < state.sa.size; ++j) {
-				if (state.sa.data[j] == val) {
-					fprintf(stderr, "Duplicate value `%d` in state at position %d", val, i);
-					exit(1);
-				}
+			input[i].value = (int)strtol(av[opts.list + (int)i], &end, 10);
+			input[i].pos = i;
+		}
+		qsort(input, state_capacity, sizeof(input_t), cmp_input);
+		value_t* ranks = xmalloc(sizeof(value_t) * state_capacity);
+		for (size_t i = 0; i < state_capacity; ++i) {
+			if (i && input[i].value == input[i - 1].value) {
+				const size_t pos = input[i].pos > input[i - 1].pos ? input[i].pos : input[i - 1].pos;
+				fprintf(stderr,
+				        "Duplicate value `%d` in state at position %zu",
+				        input[i].value,
+				        (size_t)opts.list + pos);
+				exit(1);
 			}
-			state.sa.data[state.sa.size++] = val;
+			ranks[input[i].pos] = (value_t)i;
 		}
+		for (size_t i = 0; i < state_capacity; ++i)
+			stack_append(&state.sa, ranks[i]);
+		free(ranks);
+		free(input);
 	} else if (opts.generate) {
 		for (size_t i = 0; i < state_capacity; ++i) {
 			while (1) {
-				int val =
-				  (int)(((uint32_t)random_int(&opts.random_state)) % (uint32_t)state_capacity);
+				value_t val =
+				  (value_t)(((uint32_t)random_int(&opts.random_state)) % (uint32_t)state_capacity);
 				int valid = 1;
 				for (size_t j = 0; j < state.sa.size; ++j) {
-					if (state.sa.data[j] == val) {
+					if (stack_get(&state.sa, j) == val) {
 						valid = 0;
 						break;
 					}
 				}
 				if (valid) {
-					state.sa.data[state.sa.size++] = val;
+					stack_append(&state.sa, val);
 					break;
 				}
 			}
@@ -225,6 +344,10 @@ main(int ac, char** av)
 		  .tol = 0.001f,
 		  .initial_scale = 0.55f,
 		  .final_radius = 20,
+		  // Speculating did not find better pivots, and evaluates points steps may not need
+		  .speculative = 0,
+		  // Searches started from similar blocks' pivots take fewer iterations
+		  .warm_shrink = 2.f,
 		});
 	else if (!strcmp(opts.method, "poly"))
 		data = quicksort_poly((quicksort_poly_t){ .max_depth = 0,
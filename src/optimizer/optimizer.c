@@ -21,25 +21,134 @@ sz_min(size_t a, size_t b)
 	return b;
 }
 
+/** Saves of the original state, reconstructed around the position being optimized */
+typedef struct
+{
+	/** Ring of reconstructed saves, save `i` lives in `saves[i % capacity]` */
+	save_t* saves;
+	/** Number of saves `saves` holds */
+	size_t capacity;
+	/** Index of the first reconstructed save in the original state */
+	size_t start;
+	/** Number of reconstructed saves */
+	size_t size;
+	/** Open-addressing map from save hash to `index + 1` in the original state, 0 for
+	 * empty slots */
+	size_t* table;
+	/** Mask of `table`'s capacity (power of two) */
+	size_t mask;
+} window_t;
+
+static void
+window_insert(window_t* window, size_t i)
+{
+	size_t slot = window->saves[i % window->capacity].hash & window->mask;
+	while (window->table[slot])
+		slot = (slot + 1) & window->mask;
+	window->table[slot] = i + 1;
+}
+
+/** Remove save `i` from the map, shifting back the entries probed past it */
+static void
+window_remove(window_t* window, size_t i)
+{
+	size_t slot = window->saves[i % window->capacity].hash & window->mask;
+	while (window->table[slot] != i + 1)
+		slot = (slot + 1) & window->mask;
+	window->table[slot] = 0;
+	for (size_t next = (slot + 1) & window->mask; window->table[next];
+	     next = (next + 1) & window->mask) {
+		const save_t* save = &window->saves[(window->table[next] - 1) % window->capacity];
+		const size_t home = save->hash & window->mask;
+		// Entries whose probe starts within (slot, next] stay reachable
+		if (((next - home) & window->mask) < ((next - slot) & window->mask))
+			continue;
+		window->table[slot] = window->table[next];
+		window->table[next] = 0;
+		slot = next;
+	}
+}
+
+static window_t
+window_new(const state_t* orig_state, const optimizer_conf_t* cfg, size_t start)
+{
+	const size_t capacity = orig_state->sa.capacity;
+	window_t window = {
+		.start = start,
+		.size = sz_min(cfg->search_width + cfg->search_depth, orig_state->saves_size - start),
+	};
+	window.capacity = window.size;
+	window.saves = xmalloc(sizeof(save_t) * window.size);
+	value_t* data = xmalloc(sizeof(value_t) * capacity * window.size);
+	for (size_t i = 0; i < window.size; ++i)
+		window.saves[i].data = data + i * capacity;
+	// The ring wraps around once: saves up to its end, then those from its beginning
+	const size_t wrap = window.size - start % window.size;
+	state_load_saves(orig_state, start, wrap, window.saves + start % window.size);
+	state_load_saves(orig_state, start + wrap, window.size - wrap, window.saves);
+
+	// Build hash map, with a load factor below 1/2
+	size_t table_capacity = 16;
+	while (table_capacity < 2 * window.size)
+		table_capacity *= 2;
+	window.mask = table_capacity - 1;
+	window.table = xmalloc(sizeof(size_t) * table_capacity);
+	bzero(window.table, sizeof(size_t) * table_capacity);
+	for (size_t i = 0; i < window.size; ++i)
+		window_insert(&window, start + i);
+	return window;
+}
+
+/** Move the window one save forward, reconstructing only the save entering it */
+static void
+window_slide(window_t* window, const state_t* orig_state)
+{
+	assert(window->size != 0);
+	const size_t end = window->start + window->size;
+	window_remove(window, window->start);
+	++window->start;
+	if (end == orig_state->saves_size) {
+		--window->size;
+		return;
+	}
+	// The entering save takes the ring slot of the one leaving
+	state_load_saves(orig_state, end, 1, &window->saves[end % window->capacity]);
+	window_insert(window, end);
+}
+
+static void
+window_destroy(window_t* window)
+{
+	if (window->capacity)
+		free(window->saves[0].data);
+	free(window->saves);
+	free(window->table);
+}
+
 /** Find the last index in `orig_state` that is equal to `state` */
 static inline size_t
 find_future(const state_t* orig_state,
+            const window_t* window,
             const state_t* state,
             const optimizer_conf_t* cfg,
             size_t start)
 {
-	assert(state->saves_size != 0);
-	const size_t end = sz_min(start + cfg->search_width, orig_state->saves_size);
+	assert(start >= window->start);
+	const size_t end = sz_min(sz_min(start + cfg->search_width, orig_state->saves_size),
+	                          window->start + window->size);
 
+	const uint64_t hash = state_hash(state);
 	size_t best = 0;
-	for (size_t i = start; i < end; ++i) {
-		const save_t* orig = &orig_state->saves[i];
+	for (size_t slot = hash & window->mask; window->table[slot];
+	     slot = (slot + 1) & window->mask) {
+		const size_t i = window->table[slot] - 1;
+		const save_t* orig = &window->saves[i % window->capacity];
+		if (orig->hash != hash || i < start || i >= end || i <= best)
+			continue;
 		if (state->sa.size != orig->sz_a || state->sb.size != orig->sz_b)
 			continue;
-		const int* orig_a = orig->data;
-		const int* orig_b = orig->data + orig->sz_a;
-		if (!memcmp(orig_a, state->sa.data, sizeof(int) * state->sa.size) &&
-		    !memcmp(orig_b, state->sb.data, sizeof(int) * state->sb.size))
+		if (stack_equal(&state->sa, orig->data) &&
+		    stack_equal(&state->sb, orig->data + orig->sz_a))
 			best = i;
 	}
 	return best;
@@ -178,6 +287,7 @@ should_prune(const state_t* state, size_t depth, enum stack_op op, enum stack_op
 
 static inline void
 backtrack(const state_t* orig_state,   /* Original state */
+          const window_t* window,      /* Reconstructed saves of the original state */
           state_t* state,              /* Bifurcated state */
           size_t start,                /* Index in original state */
           const optimizer_conf_t* cfg, /* Optimizer configuration */
@@ -196,7 +306,7 @@ backtrack(const state_t* orig_state,   /* Original state */
 		cur_ops[depth - 1] = ops[i];
 		state_op(state, ops[i]);
 		size_t search_from = start + depth;
-		size_t skip = find_future(orig_state, state, cfg, search_from);
+		size_t skip = find_future(orig_state, window, state, cfg, search_from);
 
 		if (skip > search_from) {
 			size_t original_cost = skip - start;
@@ -215,7 +325,7 @@ backtrack(const state_t* orig_state,   /* Original state */
 
 		// Recurse
 		if (depth < cfg->search_depth && ops[i] != STACK_OP_NOP)
-			backtrack(orig_state, state, start, cfg, depth + 1, skip_data, cur_ops);
+			backtrack(orig_state, window, state, start, cfg, depth + 1, skip_data, cur_ops);
 		state_undo(state, ops[i]);
 		skip_data->cur_cost -= ops[i] != STACK_OP_NOP;
 	}
@@ -268,6 +378,8 @@ build_optimal_walk(const state_t* orig_state,
 
 	enum stack_op* out = xmalloc(orig_state->saves_size * sizeof(enum stack_op));
 	size_t out_len = 0;
+	enum stack_op* oplog = xmalloc(orig_state->saves_size * sizeof(enum stack_op));
+	state_load_ops(orig_state, 0, orig_state->saves_size, oplog);
 
 	// Build walk
 	size_t i = 0;
@@ -286,11 +398,12 @@ build_optimal_walk(const state_t* orig_state,
 		// Emit original instructions
 		else {
 			assert(out_len < orig_state->saves_size);
-			out[out_len++] = orig_state->saves[i + 1].op;
+			out[out_len++] = oplog[i + 1];
 			i += 1;
 		}
 	}
 
+	free(oplog);
 	free(dp);
 	free(decision);
 	*ops_count_out = out_len;
@@ -304,35 +417,47 @@ optimize(const state_t* state, optimizer_conf_t cfg)
 
 	// Compute skip_data
 	size_t i;
-#pragma omp parallel for schedule(dynamic) shared(state, cfg, skip_data) private(i)
-	for (i = 0; i < state->saves_size - 1; ++i) {
-		skip_data_t* const data = (skip_data_t*)((char*)skip_data + i * skip_data_stride(&cfg));
-
-		enum stack_op* ops = xmalloc(sizeof(enum stack_op) * cfg.search_depth);
-		// Bifurcate & Evaluate
-		state_t bi = state_bifurcate(state, i + 1);
-		backtrack(state, &bi, i, &cfg, 1, data, ops);
-		state_destroy(&bi);
-		free(ops);
-
-		/*
-		printf("Found skip at %zu: skip=%zu len=%zu value=%zu\n",
-		       i,
-		       data->skip,
-		       data->len,
-		       data->value);
-
-		for (size_t j = 0; j < data->len; ++j) {
-		    printf("%s\n", op_name(data->ops[j]));
-		}
+#pragma omp parallel shared(state, cfg, skip_data) private(i)
+	{
+		// Static chunks are contiguous: each thread slides a single window over its chunk
+		window_t window = { .saves = NULL };
+#pragma omp for schedule(static)
+		for (i = 0; i < state->saves_size - 1; ++i) {
+			skip_data_t* const data =
+			  (skip_data_t*)((char*)skip_data + i * skip_data_stride(&cfg));
+
+			enum stack_op* ops = xmalloc(sizeof(enum stack_op) * cfg.search_depth);
+			// Bifurcate & Evaluate
+			state_t bi = state_bifurcate(state, i + 1);
+			if (!window.saves)
+				window = window_new(state, &cfg, i + 1);
+			else
+				window_slide(&window, state);
+			assert(window.start == i + 1);
+			backtrack(state, &window, &bi, i, &cfg, 1, data, ops);
+			state_destroy(&bi);
+			free(ops);
+
+			/*
+			printf("Found skip at %zu: skip=%zu len=%zu value=%zu\n",
+			       i,
+			       data->skip,
+			       data->len,
+			       data->value);
+
+			for (size_t j = 0; j < data->len; ++j) {
+			    printf("%s\n", op_name(data->ops[j]));
+			}
 
-		if (data->skip) {
-		    state_t s = state_bifurcate(state, data->skip + 1);
-		    ps(&s);
-		    state_destroy(&s);
+			if (data->skip) {
+			    state_t s = state_bifurcate(state, data->skip + 1);
+			    ps(&s);
+			    state_destroy(&s);
+			}
+			printf("\n\n");
+			*/
 		}
-		printf("\n\n");
-		*/
+		window_destroy(&window);
 	}
 
 	size_t ops_count;
@@ -340,10 +465,12 @@ optimize(const state_t* state, optimizer_conf_t cfg)
 
 	state_t final = state_deep_bifurcate(state, state->saves_size > 1 ? 1 : 0);
 	final.op_count = 0;
-	for (size_t i = 0; i < ops_count; ++i) {
+	for (size_t i = 0, run; i < ops_count; i += run) {
 		//printf("op=%s\n", op_name(ops[i]));
+		for (run = 1; i + run < ops_count && ops[i + run] == ops[i]; ++run)
+			;
 		if (ops[i] != STACK_OP_NOP)
-			state_op(&final, ops[i]);
+			state_op_n(&final, ops[i], run);
 	}
 	free(ops);
 	free(skip_data);
@@ -6,8 +6,8 @@ static inline void
 test(optimizer_conf_t cfg, const int* array, size_t size)
 {
 	state_t state = state_new(size);
-	memcpy(state.sa.data, array, sizeof(int) * size);
-	state.sa.size = size;
+	for (size_t i = 0; i < size; ++i)
+		stack_append(&state.sa, (value_t)array[i]);
 
 	quicksort_data_t data = quicksort_nm((quicksort_nm_t){
 	  .max_depth = 0,
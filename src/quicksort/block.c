@@ -1,5 +1,7 @@
 #include <quicksort/quicksort.h>
+#include <quicksort/sort_tables.h>
 #include <stdio.h>
+#include <string.h>
 
 const char*
 blk_dest_name(enum blk_dest dest)
@@ -13,25 +15,25 @@ blk_dest_name(enum blk_dest dest)
 	return names[dest];
 }
 
-inline int
+inline value_t
 blk_value(const state_t* state, enum blk_dest blk, size_t pos)
 {
 	switch (blk) {
 		case BLK_A_TOP:
 			assert(state->sa.size > pos);
-			return state->sa.data[pos];
+			return stack_get(&state->sa, pos);
 			break;
 		case BLK_A_BOT:
 			assert(state->sa.size > pos);
-			return state->sa.data[state->sa.size - pos - 1];
+			return stack_get(&state->sa, state->sa.size - pos - 1);
 			break;
 		case BLK_B_TOP:
 			assert(state->sb.size > pos);
-			return state->sb.data[pos];
+			return stack_get(&state->sb, pos);
 			break;
 		case BLK_B_BOT:
 			assert(state->sb.size > pos);
-			return state->sb.data[state->sb.size - pos - 1];
+			return stack_get(&state->sb, state->sb.size - pos - 1);
 			break;
 		default:
 			assert(0);
@@ -39,171 +41,490 @@ blk_value(const state_t* state, enum blk_dest blk, size_t pos)
 	}
 }
 
+void
+blk_values(const state_t* state, blk_t blk, value_t* out)
+{
+	const stack_t* const stack = (blk.dest & BLK_SEL__) == BLK_A__ ? &state->sa : &state->sb;
+	assert(stack->size >= blk.size);
+	if (blk.size == 0)
+		return;
+
+	// The block is at most two runs of the ring, the second one starting at its beginning
+	const size_t first = stack_index(stack, (blk.dest & BLK_POS__) == BLK_TOP__
+	                                          ? 0
+	                                          : stack->size - blk.size);
+	const size_t len = blk.size < stack->capacity - first ? blk.size : stack->capacity - first;
+	if ((blk.dest & BLK_POS__) == BLK_TOP__) {
+		memcpy(out, stack->data + first, sizeof(value_t) * len);
+		memcpy(out + len, stack->data, sizeof(value_t) * (blk.size - len));
+		return;
+	}
+	// Bottom blocks start from the stack's bottom
+	const value_t* const data = stack->data;
+#pragma omp simd
+	for (size_t i = 0; i < len; ++i)
+		out[blk.size - 1 - i] = data[first + i];
+#pragma omp simd
+	for (size_t i = len; i < blk.size; ++i)
+		out[blk.size - 1 - i] = data[i - len];
+}
+
+void
+blk_sorted_values(const state_t* state, blk_t blk, value_t* out)
+{
+	if (blk.size == 0)
+		return;
+	blk_values(state, blk, out);
+	value_t min = VALUE_MAX;
+	value_t max = 0;
+#pragma omp simd reduction(min : min) reduction(max : max)
+	for (size_t i = 0; i < blk.size; ++i) {
+		min = out[i] < min ? out[i] : min;
+		max = out[i] > max ? out[i] : max;
+	}
+
+	// Splits keep blocks a contiguous range of ranks, which are then known without sorting
+	if ((size_t)(max - min) + 1 == blk.size) {
+#pragma omp simd
+		for (size_t i = 0; i < blk.size; ++i)
+			out[i] = (value_t)(min + i);
+		return;
+	}
+
+	// Mark present values, then read them back in order
+	const arena_mark_t mark = arena_mark();
+	const size_t range = (size_t)(max - min) + 1;
+	uint64_t* const bitmap = arena_alloc(sizeof(uint64_t) * ((range + 63) / 64));
+	memset(bitmap, 0, sizeof(uint64_t) * ((range + 63) / 64));
+	for (size_t i = 0; i < blk.size; ++i) {
+		const size_t bit = (size_t)(out[i] - min);
+		bitmap[bit / 64] |= 1ull << (bit % 64);
+	}
+	size_t count = 0;
+	for (size_t word = 0; word < (range + 63) / 64; ++word) {
+		for (uint64_t bits = bitmap[word]; bits; bits &= bits - 1)
+			out[count++] = (value_t)(min + word * 64 + (size_t)__builtin_ctzll(bits));
+	}
+	assert(count == blk.size);
+	arena_reset(mark);
+}
+
+void
+blk_select(const state_t* state, blk_t blk, const size_t* ranks, size_t count, value_t* out)
+{
+	const arena_mark_t mark = arena_mark();
+	value_t* const values = arena_alloc(sizeof(value_t) * blk.size);
+	blk_values(state, blk, values);
+	value_t min = VALUE_MAX;
+	value_t max = 0;
+#pragma omp simd reduction(min : min) reduction(max : max)
+	for (size_t i = 0; i < blk.size; ++i) {
+		min = values[i] < min ? values[i] : min;
+		max = values[i] > max ? values[i] : max;
+	}
+
+	if ((size_t)(max - min) + 1 != blk.size)
+		blk_sorted_values(state, blk, values);
+	for (size_t i = 0; i < count; ++i) {
+		assert(ranks[i] < blk.size);
+		out[i] = (size_t)(max - min) + 1 == blk.size ? (value_t)(min + ranks[i]) : values[ranks[i]];
+	}
+	arena_reset(mark);
+}
+
+state_t
+blk_state(const state_t* state, blk_t blk)
+{
+	const stack_t* const own = (blk.dest & BLK_SEL__) == BLK_A__ ? &state->sa : &state->sb;
+	const stack_t* const other = (blk.dest & BLK_SEL__) == BLK_A__ ? &state->sb : &state->sa;
+	assert(own->size >= blk.size);
+	const int own_sentinel = own->size > blk.size;
+	const int other_sentinel = other->size != 0;
+
+	state_t new = state_scratch(blk.size + (size_t)own_sentinel + (size_t)other_sentinel);
+	new.op_count = state->op_count;
+	new.search_depth = state->search_depth;
+
+	stack_t* const new_own = (blk.dest & BLK_SEL__) == BLK_A__ ? &new.sa : &new.sb;
+	stack_t* const new_other = (blk.dest & BLK_SEL__) == BLK_A__ ? &new.sb : &new.sa;
+	if (own_sentinel && (blk.dest & BLK_POS__) == BLK_BOT__)
+		stack_append(new_own, VALUE_MAX);
+	const arena_mark_t mark = arena_mark();
+	value_t* const values = arena_alloc(sizeof(value_t) * blk.size);
+	blk_values(state, blk, values);
+	for (size_t i = 0; i < blk.size; ++i) {
+		const size_t pos = (blk.dest & BLK_POS__) == BLK_TOP__ ? i : blk.size - i - 1;
+		stack_append(new_own, values[pos]);
+	}
+	arena_reset(mark);
+	if (own_sentinel && (blk.dest & BLK_POS__) == BLK_TOP__)
+		stack_append(new_own, VALUE_MAX);
+	if (other_sentinel)
+		stack_append(new_other, VALUE_MAX);
+	return new;
+}
+
+/** @brief Apply a `STACK_OP_NOP` terminated list of operations, by runs */
+static inline void
+blk_apply(state_t* state, const enum stack_op* ops)
+{
+	for (size_t i = 0, run; ops[i] != STACK_OP_NOP; i += run) {
+		for (run = 1; ops[i + run] == ops[i]; ++run)
+			;
+		state_op_n(state, ops[i], run);
+	}
+}
+
+/** @brief Rotation moving a value from @p from to @p to, `STACK_OP_NOP` for none */
+static inline enum stack_op
+blk_rotation(enum blk_dest from, enum blk_dest to)
+{
+	if ((from & BLK_SEL__) != (to & BLK_SEL__) || from == to)
+		return STACK_OP_NOP;
+	if ((from & BLK_SEL__) == BLK_A__)
+		return (from & BLK_POS__) == BLK_TOP__ ? STACK_OP_RA : STACK_OP_RRA;
+	return (from & BLK_POS__) == BLK_TOP__ ? STACK_OP_RB : STACK_OP_RRB;
+}
+
+/** @brief `STACK_OP_NOP` terminated operations moving a value, by `(from << 2) | to` */
+static const enum stack_op blk_moves[16][4] = {
+	[(BLK_A_TOP << 2) | BLK_A_TOP] = { STACK_OP_NOP },
+	[(BLK_A_TOP << 2) | BLK_A_BOT] = { STACK_OP_RA, STACK_OP_NOP },
+	[(BLK_A_TOP << 2) | BLK_B_TOP] = { STACK_OP_PB, STACK_OP_NOP },
+	[(BLK_A_TOP << 2) | BLK_B_BOT] = { STACK_OP_PB, STACK_OP_RB, STACK_OP_NOP },
+
+	[(BLK_A_BOT << 2) | BLK_A_TOP] = { STACK_OP_RRA, STACK_OP_NOP },
+	[(BLK_A_BOT << 2) | BLK_A_BOT] = { STACK_OP_NOP },
+	[(BLK_A_BOT << 2) | BLK_B_TOP] = { STACK_OP_RRA, STACK_OP_PB, STACK_OP_NOP },
+	[(BLK_A_BOT << 2) | BLK_B_BOT] = { STACK_OP_RRA, STACK_OP_PB, STACK_OP_RB, STACK_OP_NOP },
+
+	[(BLK_B_TOP << 2) | BLK_A_TOP] = { STACK_OP_PA, STACK_OP_NOP },
+	[(BLK_B_TOP << 2) | BLK_A_BOT] = { STACK_OP_PA, STACK_OP_RA, STACK_OP_NOP },
+	[(BLK_B_TOP << 2) | BLK_B_TOP] = { STACK_OP_NOP },
+	[(BLK_B_TOP << 2) | BLK_B_BOT] = { STACK_OP_RB, STACK_OP_NOP },
+
+	[(BLK_B_BOT << 2) | BLK_A_TOP] = { STACK_OP_RRB, STACK_OP_PA, STACK_OP_NOP },
+	[(BLK_B_BOT << 2) | BLK_A_BOT] = { STACK_OP_RRB, STACK_OP_PA, STACK_OP_RA, STACK_OP_NOP },
+	[(BLK_B_BOT << 2) | BLK_B_TOP] = { STACK_OP_RRB, STACK_OP_NOP },
+	[(BLK_B_BOT << 2) | BLK_B_BOT] = { STACK_OP_NOP },
+};
+
 void
 blk_move(state_t* state, enum blk_dest from, enum blk_dest to)
 {
 	assert(((from & BLK_SEL__) == BLK_A__ && state->sa.size) ||
 	       ((from & BLK_SEL__) == BLK_B__ && state->sb.size));
 
-	static const enum stack_op table[16][4] = {
-		[(BLK_A_TOP << 2) | BLK_A_TOP] = { STACK_OP_NOP },
-		[(BLK_A_TOP << 2) | BLK_A_BOT] = { STACK_OP_RA, STACK_OP_NOP },
-		[(BLK_A_TOP << 2) | BLK_B_TOP] = { STACK_OP_PB, STACK_OP_NOP },
-		[(BLK_A_TOP << 2) | BLK_B_BOT] = { STACK_OP_PB, STACK_OP_RB, STACK_OP_NOP },
-
-		[(BLK_A_BOT << 2) | BLK_A_TOP] = { STACK_OP_RRA, STACK_OP_NOP },
-		[(BLK_A_BOT << 2) | BLK_A_BOT] = { STACK_OP_NOP },
-		[(BLK_A_BOT << 2) | BLK_B_TOP] = { STACK_OP_RRA, STACK_OP_PB, STACK_OP_NOP },
-		[(BLK_A_BOT << 2) | BLK_B_BOT] = { STACK_OP_RRA, STACK_OP_PB, STACK_OP_RB, STACK_OP_NOP },
-
-		[(BLK_B_TOP << 2) | BLK_A_TOP] = { STACK_OP_PA, STACK_OP_NOP },
-		[(BLK_B_TOP << 2) | BLK_A_BOT] = { STACK_OP_PA, STACK_OP_RA, STACK_OP_NOP },
-		[(BLK_B_TOP << 2) | BLK_B_TOP] = { STACK_OP_NOP },
-		[(BLK_B_TOP << 2) | BLK_B_BOT] = { STACK_OP_RB, STACK_OP_NOP },
-
-		[(BLK_B_BOT << 2) | BLK_A_TOP] = { STACK_OP_RRB, STACK_OP_PA, STACK_OP_NOP },
-		[(BLK_B_BOT << 2) | BLK_A_BOT] = { STACK_OP_RRB, STACK_OP_PA, STACK_OP_RA, STACK_OP_NOP },
-		[(BLK_B_BOT << 2) | BLK_B_TOP] = { STACK_OP_RRB, STACK_OP_NOP },
-		[(BLK_B_BOT << 2) | BLK_B_BOT] = { STACK_OP_NOP },
-	};
-
 	const unsigned int id = (from << 2) | to;
 	assert(id < 16);
-	for (size_t i = 0; table[id][i] != STACK_OP_NOP; ++i)
-		state_op(state, table[id][i]);
+	blk_apply(state, blk_moves[id]);
 }
 
-/** @brief Rank a block */
-static inline int
-blk_rank(const state_t* state, blk_t blk)
+/** @brief Lehmer rank of the permutation of a block of at most `BLK_SORT_MAX` values */
+static inline size_t
+blk_perm_rank(const state_t* state, blk_t blk)
 {
-	assert(blk.size != 0);
-	assert(blk.size <= 3);
+	assert(blk.size <= BLK_SORT_MAX);
 
-	if (blk.size == 1)
-		return 0;
-	if (blk.size == 2)
-		return blk_value(state, blk.dest, 0) > blk_value(state, blk.dest, 1);
-
-	const int u = blk_value(state, blk.dest, 0);
-	const int v = blk_value(state, blk.dest, 1);
-	const int w = blk_value(state, blk.dest, 2);
-	return 1 * (u > v && v > w) + 2 * (u > w && w > v) + 3 * (v > u && u > w) +
-	       4 * (v > w && w > u) + 5 * (w > u && u > v) + 6 * (w > v && v > u) - 1;
+	value_t values[BLK_SORT_MAX];
+	blk_values(state, blk, values);
+	size_t rank = 0;
+	for (size_t i = 0; i < blk.size; ++i) {
+		size_t smaller = 0;
+		for (size_t j = i + 1; j < blk.size; ++j)
+			smaller += values[j] < values[i];
+		rank = rank * (blk.size - i) + smaller;
+	}
+	return rank;
 }
 
-/** Move a block of size 2 on A_TOP, sorted */
 void
-blk_sort_2(state_t* state, blk_t blk)
-{
-	assert(blk.size == 2);
-
-	// u = blk_value(0), v = blk_value(1)
-	static const enum stack_op table[4][2][6] = {
-		[BLK_A_TOP] = {
-			// u < v
-			[0] = {STACK_OP_NOP},
-			// u > v
-			[1] = {STACK_OP_SA, STACK_OP_NOP},
-		},
-		[BLK_A_BOT] = {
-			// u < v
-			[0] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_NOP},
-			// u > v
-			[1] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_NOP},
-		},
-		[BLK_B_TOP] = {
-			// u < v
-			[0] = {STACK_OP_PA, STACK_OP_PA, STACK_OP_SA, STACK_OP_NOP},
-			// u > v
-			[1] = {STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-		},
-		[BLK_B_BOT] = {
-			// u < v
-			[0] = {STACK_OP_RRB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			// u > v
-			[1] = {STACK_OP_RRB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_SA, STACK_OP_NOP},
-		},
-	};
+blk_sort_small(state_t* state, blk_t blk)
+{
+	assert(blk.size >= 2 && blk.size <= BLK_SORT_MAX);
 
-	const int rank = blk_rank(state, blk);
-	assert(rank == 0 || rank == 1);
-	for (size_t i = 0; table[blk.dest][rank][i] != STACK_OP_NOP; ++i)
-		state_op(state, table[blk.dest][rank][i]);
+	const size_t rank = blk_perm_rank(state, blk);
+	const uint8_t* const ops = blk_sort_ops + blk_sort_index[blk.size][blk.dest][rank];
+	for (size_t i = 0, run; ops[i] != STACK_OP_NOP; i += run) {
+		for (run = 1; ops[i + run] == ops[i]; ++run)
+			;
+		state_op_n(state, (enum stack_op)ops[i], run);
+	}
 }
 
-/** Move a block of size 3 to A_TOP, sorted */
 void
-blk_sort_3(state_t* state, blk_t blk)
-{
-	assert(blk.size == 3);
-
-	// u = blk_value(0), v = blk_value(1), w = blk_value(2)
-	static const enum stack_op table[4][6][8] = {
-		[BLK_A_TOP] = {
-			[0] = {STACK_OP_SA, STACK_OP_RA, STACK_OP_SA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_NOP},
-			[1] = {STACK_OP_SA, STACK_OP_RA, STACK_OP_SA, STACK_OP_RRA, STACK_OP_NOP},
-			[2] = {STACK_OP_RA, STACK_OP_SA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_NOP},
-			[3] = {STACK_OP_RA, STACK_OP_SA, STACK_OP_RRA, STACK_OP_NOP},
-			[4] = {STACK_OP_SA, STACK_OP_NOP},
-			[5] = {STACK_OP_NOP},
-		},
-		[BLK_A_BOT] = {
-			[0] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_RRA, STACK_OP_NOP},
-			[1] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_NOP},
-			[2] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_RRA, STACK_OP_NOP},
-			[3] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_NOP},
-			[4] = {STACK_OP_RRA, STACK_OP_RRA, STACK_OP_PB, STACK_OP_RRA, STACK_OP_SA, STACK_OP_PA, STACK_OP_NOP},
-			[5] = {STACK_OP_RRA, STACK_OP_PB, STACK_OP_RRA, STACK_OP_RRA, STACK_OP_SA, STACK_OP_PA, STACK_OP_NOP},
-		},
-		[BLK_B_TOP] = {
-			[0] = {STACK_OP_PA, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[1] = {STACK_OP_PA, STACK_OP_SB, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[2] = {STACK_OP_SB, STACK_OP_PA, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[3] = {STACK_OP_SB, STACK_OP_PA, STACK_OP_SB, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[4] = {STACK_OP_PA, STACK_OP_SB, STACK_OP_PA, STACK_OP_SA, STACK_OP_PA, STACK_OP_NOP},
-			[5] = {STACK_OP_SB, STACK_OP_PA, STACK_OP_SB, STACK_OP_PA, STACK_OP_SA, STACK_OP_PA, STACK_OP_NOP},
-		},
-		[BLK_B_BOT] = {
-			[0] = {STACK_OP_RRB, STACK_OP_PA, STACK_OP_RRB, STACK_OP_PA, STACK_OP_RRB, STACK_OP_PA, STACK_OP_NOP},
-			[1] = {STACK_OP_RRB, STACK_OP_PA, STACK_OP_RRB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[2] = {STACK_OP_RRB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_RRB, STACK_OP_PA, STACK_OP_NOP},
-			[3] = {STACK_OP_RRB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[4] = {STACK_OP_RRB, STACK_OP_RRB, STACK_OP_SB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-			[5] = {STACK_OP_RRB, STACK_OP_RRB, STACK_OP_RRB, STACK_OP_PA, STACK_OP_PA, STACK_OP_PA, STACK_OP_NOP},
-		},
-	};
+blk_skip_sort(state_t* state, blk_t blk, size_t cost)
+{
+	assert(state->undo_marks != 0);
 
-	const int rank = blk_rank(state, blk);
-	assert(rank < 6);
-	for (size_t i = 0; table[blk.dest][rank][i] != STACK_OP_NOP; ++i)
-		state_op(state, table[blk.dest][rank][i]);
+	const size_t op_count = state->op_count;
+	switch (blk.dest) {
+		case BLK_A_TOP:
+			break;
+		case BLK_A_BOT:
+			state_op_n(state, STACK_OP_RRA, blk.size);
+			break;
+		case BLK_B_TOP:
+			state_op_n(state, STACK_OP_PA, blk.size);
+			break;
+		case BLK_B_BOT:
+			state_op_n(state, STACK_OP_RRB, blk.size);
+			state_op_n(state, STACK_OP_PA, blk.size);
+			break;
+	}
+	state->op_count = op_count + cost;
+}
+
+int
+blk_sort_presorted(state_t* state, blk_t blk)
+{
+	const stack_t* const own = (blk.dest & BLK_SEL__) == BLK_A__ ? &state->sa : &state->sb;
+	const size_t n = blk.size;
+	if (n < 2)
+		return 0;
+
+	// Count descents, and remember the last one
+	const arena_mark_t mark = arena_mark();
+	value_t* const values = arena_alloc(sizeof(value_t) * n);
+	blk_values(state, blk, values);
+	size_t descents = 0;
+	size_t last_descent = 0;
+	size_t last_ascent = 0;
+	for (size_t i = 0; i + 1 < n; ++i) {
+		if (values[i] > values[i + 1]) {
+			++descents;
+			last_descent = i;
+		} else
+			last_ascent = i;
+	}
+	const int wraps_up = values[n - 1] < values[0];
+	arena_reset(mark);
+
+	const int ascending = descents == 0;
+	const int descending = descents == n - 1;
+	switch (blk.dest) {
+		case BLK_A_TOP:
+			if (ascending)
+				return 1;
+			// A rotation of sorted order filling A only needs rotating
+			if (own->size == n && descents == 1 && wraps_up) {
+				const size_t r = last_descent + 1;
+				if (r <= n - r)
+					state_op_n(state, STACK_OP_RA, r);
+				else
+					state_op_n(state, STACK_OP_RRA, n - r);
+				return 1;
+			}
+			return 0;
+		case BLK_A_BOT:
+			if (!descending)
+				return 0;
+			state_op_n(state, STACK_OP_RRA, n);
+			return 1;
+		case BLK_B_TOP:
+			// A rotation of reverse order filling B is rotated before pushing it
+			if (own->size == n && descents == n - 2 && !wraps_up) {
+				const size_t r = last_ascent + 1;
+				if (r <= n - r)
+					state_op_n(state, STACK_OP_RB, r);
+				else
+					state_op_n(state, STACK_OP_RRB, n - r);
+			} else if (!descending)
+				return 0;
+			state_op_n(state, STACK_OP_PA, n);
+			return 1;
+		case BLK_B_BOT:
+			if (ascending) {
+				state_op_n(state, STACK_OP_RRB, n);
+				state_op_n(state, STACK_OP_PA, n);
+				return 1;
+			}
+			if (!descending)
+				return 0;
+			for (size_t i = 0; i < n; ++i) {
+				state_op(state, STACK_OP_RRB);
+				state_op(state, STACK_OP_PA);
+			}
+			return 1;
+	}
+	return 0;
 }
 
 /* --- Quicksort --- */
-split_t
-blk_split(state_t* state, blk_t blk, int p1, int p2)
+/** @brief Order of a layout's locations among the default ones, keeping `bot` first */
+static const uint8_t blk_layout_perms[BLK_LAYOUTS_MAX][3] = {
+	{ 0, 1, 2 }, { 1, 0, 2 }, { 0, 2, 1 }, { 2, 0, 1 }, { 1, 2, 0 }, { 2, 1, 0 },
+};
+
+size_t
+blk_layouts(enum blk_dest dest)
+{
+	// A's top can only receive the block sorted first, which is `bot` by default
+	return dest == BLK_A_TOP ? BLK_LAYOUTS_MAX : 2;
+}
+
+/** @brief Empty blocks receiving the values when splitting a block at @p dest */
+static inline split_t
+blk_split_dests(enum blk_dest dest, size_t layout)
 {
-	split_t split = {
-		.top = { .size = 0, .dest = blk.dest == BLK_B_BOT ? BLK_B_TOP : BLK_B_BOT },
-		.mid = { .size = 0, .dest = (blk.dest & BLK_SEL__) == BLK_B__ ? BLK_A_BOT : BLK_B_TOP },
-		.bot = { .size = 0, .dest = blk.dest == BLK_A_TOP ? BLK_A_BOT : BLK_A_TOP },
+	assert(layout < blk_layouts(dest));
+
+	const enum blk_dest dests[3] = {
+		dest == BLK_B_BOT ? BLK_B_TOP : BLK_B_BOT,
+		(dest & BLK_SEL__) == BLK_B__ ? BLK_A_BOT : BLK_B_TOP,
+		dest == BLK_A_TOP ? BLK_A_BOT : BLK_A_TOP,
+	};
+	const uint8_t* const perm = blk_layout_perms[layout];
+	return (split_t){
+		.top = { .size = 0, .dest = dests[perm[0]] },
+		.mid = { .size = 0, .dest = dests[perm[1]] },
+		.bot = { .size = 0, .dest = dests[perm[2]] },
 	};
+}
+
+/** @brief Number of operations moving a value from @p from to @p to */
+static inline size_t
+blk_move_cost(enum blk_dest from, enum blk_dest to)
+{
+	const enum stack_op* const ops = blk_moves[(from << 2) | to];
+	size_t len = 0;
+	while (ops[len] != STACK_OP_NOP)
+		++len;
+	return len;
+}
+
+split_t
+blk_split_sizes(blk_t blk, size_t i1, size_t i2, size_t layout)
+{
+	assert(i1 <= i2 && i2 <= blk.size);
+
+	split_t split = blk_split_dests(blk.dest, layout);
+	split.top.size = i1;
+	split.mid.size = i2 - i1;
+	split.bot.size = blk.size - i2;
+	return split;
+}
+
+size_t
+blk_split_cost(blk_t blk, size_t i1, size_t i2, size_t layout)
+{
+	const split_t split = blk_split_sizes(blk, i1, i2, layout);
+	return split.bot.size * blk_move_cost(blk.dest, split.bot.dest) +
+	       split.mid.size * blk_move_cost(blk.dest, split.mid.dest) +
+	       split.top.size * blk_move_cost(blk.dest, split.top.dest);
+}
+
+size_t
+blk_split_bound(blk_t blk, size_t i1, size_t i2, size_t layout)
+{
+	const split_t split = blk_split_sizes(blk, i1, i2, layout);
+	const blk_t* const parts[3] = { &split.bot, &split.mid, &split.top };
+	size_t bound = blk_split_cost(blk, i1, i2, layout);
+	size_t held = 0;
+	size_t rotated = 0;
+	for (size_t i = 0; i < 3; ++i) {
+		if ((parts[i]->dest & BLK_SEL__) == BLK_B__)
+			bound += parts[i]->size;
+
+		// Every fusion pairs a held back rotation with a rotation of the block's stack
+		const enum stack_op rotation = blk_rotation(blk.dest, parts[i]->dest);
+		const size_t len = blk_move_cost(blk.dest, parts[i]->dest);
+		if (rotation != STACK_OP_NOP) {
+			if ((rotation & STACK_OPERATOR__) == STACK_OP_ROTATE__)
+				rotated += parts[i]->size;
+		} else if (len &&
+		           (blk_moves[(blk.dest << 2) | parts[i]->dest][len - 1] & STACK_OPERATOR__) ==
+		             STACK_OP_ROTATE__)
+			held += parts[i]->size;
+	}
+	return bound - (held < rotated ? held : rotated);
+}
+
+/**
+ * @brief Classify the values of a block against a pair of pivots
+ *
+ * @param values Values of the block
+ * @param size Number of values
+ * @param p1 First pivot
+ * @param p2 Second pivot `p1 <= p2`
+ * @param parts Set to the part of every value, the number of pivots not above it
+ * @param counts Set to the number of values in each part
+ */
+static void
+blk_classify(const value_t* values,
+             size_t size,
+             value_t p1,
+             value_t p2,
+             uint8_t* parts,
+             size_t counts[3])
+{
+	size_t above_p1 = 0;
+	size_t above_p2 = 0;
+#pragma omp simd reduction(+ : above_p1, above_p2)
+	for (size_t i = 0; i < size; ++i) {
+		const uint8_t ge1 = values[i] >= p1;
+		const uint8_t ge2 = values[i] >= p2;
+		parts[i] = (uint8_t)(ge1 + ge2);
+		above_p1 += ge1;
+		above_p2 += ge2;
+	}
+	counts[0] = size - above_p1;
+	counts[1] = above_p1 - above_p2;
+	counts[2] = above_p2;
+}
+
+split_t
+blk_split(state_t* state, blk_t blk, value_t p1, value_t p2, size_t layout)
+{
+	// Classify the whole block up front, values leave it in order
+	const arena_mark_t mark = arena_mark();
+	value_t* const values = arena_alloc(sizeof(value_t) * blk.size);
+	uint8_t* const classes = arena_alloc(blk.size);
+	size_t counts[3];
+	blk_values(state, blk, values);
+	blk_classify(values, blk.size, p1, p2, classes, counts);
+
+	split_t split = blk_split_dests(blk.dest, layout);
+	blk_t* const parts[3] = { &split.top, &split.mid, &split.bot };
+	for (size_t i = 0; i < 3; ++i)
+		parts[i]->size = counts[i];
+
+	// Moves ending with a rotation of the other stack hold it back, so that it can be
+	// fused with a rotation of the block's stack into `rr`
+	enum stack_op pending = STACK_OP_NOP;
+	for (size_t pos = 0, run; pos < blk.size; pos += run) {
+		const uint8_t part = classes[pos];
 
-	while (blk.size) {
-		const int val = blk_value(state, blk.dest, 0);
-		if (val >= p2) {
-			blk_move(state, blk.dest, split.bot.dest);
-			++split.bot.size;
-		} else if (val >= p1) {
-			blk_move(state, blk.dest, split.mid.dest);
-			++split.mid.size;
+		// Values staying in the block's stack are rotated by runs
+		const enum stack_op rotation = blk_rotation(blk.dest, parts[part]->dest);
+		run = 1;
+		if (rotation != STACK_OP_NOP) {
+			while (pos + run < blk.size && classes[pos + run] == part)
+				++run;
+			size_t fused = 0;
+			if (pending != STACK_OP_NOP && (rotation & STACK_OPERATOR__) == STACK_OP_ROTATE__) {
+				state_op(state, STACK_OP_RR);
+				fused = 1;
+			} else if (pending != STACK_OP_NOP)
+				state_op(state, pending);
+			pending = STACK_OP_NOP;
+			state_op_n(state, rotation, run - fused);
 		} else {
-			blk_move(state, blk.dest, split.top.dest);
-			++split.top.size;
+			const enum stack_op* const ops = blk_moves[(blk.dest << 2) | parts[part]->dest];
+			const size_t len = blk_move_cost(blk.dest, parts[part]->dest);
+			if (pending != STACK_OP_NOP)
+				state_op(state, pending);
+			for (size_t i = 0; i + 1 < len; ++i)
+				state_op(state, ops[i]);
+			pending = (ops[len - 1] & STACK_OPERATOR__) == STACK_OP_ROTATE__ ? ops[len - 1]
+			                                                                 : STACK_OP_NOP;
+			if (pending == STACK_OP_NOP)
+				state_op(state, ops[len - 1]);
 		}
-		--blk.size;
 	}
+	if (pending != STACK_OP_NOP)
+		state_op(state, pending);
+	arena_reset(mark);
 	return split;
 }
 
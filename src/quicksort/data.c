@@ -1,3 +1,4 @@
+#include <math.h>
 #include <quicksort/quicksort.h>
 #include <string.h>
 
@@ -22,9 +23,184 @@ quicksort_plot_add_value(quicksort_plot_t* plot, char* value)
 	plot->tagged[plot->tagged_size++] = value;
 }
 
+quicksort_tt_entry_t*
+quicksort_tt_new(void)
+{
+	quicksort_tt_entry_t* tt = xmalloc(sizeof(quicksort_tt_entry_t) * QUICKSORT_TT_SIZE);
+	memset(tt, 0, sizeof(quicksort_tt_entry_t) * QUICKSORT_TT_SIZE);
+	return tt;
+}
+
+uint64_t
+quicksort_tt_key(const state_t* state, blk_t blk, size_t depth_override)
+{
+	const stack_t* const own = (blk.dest & BLK_SEL__) == BLK_A__ ? &state->sa : &state->sb;
+	const stack_t* const other = (blk.dest & BLK_SEL__) == BLK_A__ ? &state->sb : &state->sa;
+
+	// Relative order of the values, as offsets from the block's minimum
+	const arena_mark_t mark = arena_mark();
+	value_t* const values = arena_alloc(sizeof(value_t) * blk.size);
+	blk_values(state, blk, values);
+	value_t min = VALUE_MAX;
+#pragma omp simd reduction(min : min)
+	for (size_t i = 0; i < blk.size; ++i)
+		min = values[i] < min ? values[i] : min;
+	uint64_t key = 0xCBF29CE484222325ull;
+	for (size_t i = 0; i < blk.size; ++i)
+		key = (key ^ (value_t)(values[i] - min)) * STACK_HASH_BASE;
+	arena_reset(mark);
+
+	key ^= (uint64_t)blk.dest | (uint64_t)(own->size > blk.size) << 2 |
+	       (uint64_t)(other->size != 0) << 3;
+	key = (key ^ blk.size) * STACK_HASH_BASE;
+	key = (key ^ state->search_depth) * STACK_HASH_BASE;
+	key = (key ^ depth_override) * STACK_HASH_BASE;
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDull;
+	key ^= key >> 33;
+	return key | 1;
+}
+
+int
+quicksort_tt_probe(const quicksort_data_t* data, uint64_t key, size_t* cost)
+{
+	const quicksort_tt_entry_t* const entry = &data->tt[key & (QUICKSORT_TT_SIZE - 1)];
+	const uint64_t check = __atomic_load_n(&entry->check, __ATOMIC_RELAXED);
+	const uint64_t value = __atomic_load_n(&entry->cost, __ATOMIC_RELAXED);
+	if ((check ^ value) != key)
+		return 0;
+	*cost = (size_t)value;
+	return 1;
+}
+
+void
+quicksort_tt_store(quicksort_data_t* data, uint64_t key, size_t cost)
+{
+	quicksort_tt_entry_t* const entry = &data->tt[key & (QUICKSORT_TT_SIZE - 1)];
+	__atomic_store_n(&entry->check, key ^ (uint64_t)cost, __ATOMIC_RELAXED);
+	__atomic_store_n(&entry->cost, (uint64_t)cost, __ATOMIC_RELAXED);
+}
+
+quicksort_warm_t*
+quicksort_warm_new(void)
+{
+	quicksort_warm_t* warm = xmalloc(sizeof(quicksort_warm_t));
+	// Every byte set makes every entry QUICKSORT_WARM_UNSET
+	memset(warm, 0xFF, sizeof(quicksort_warm_t));
+	return warm;
+}
+
+/** @brief Entry of the blocks similar to @p blk */
+static uint64_t*
+quicksort_warm_entry(quicksort_warm_t* warm, const state_t* state, blk_t blk)
+{
+	assert(blk.size != 0 && state->search_depth == 0);
+	size_t size = (size_t)(63 - __builtin_clzll((unsigned long long)blk.size));
+	if (size >= QUICKSORT_WARM_SIZES)
+		size = QUICKSORT_WARM_SIZES - 1;
+	return &warm->entries[blk.dest][size];
+}
+
+int
+quicksort_warm_probe(const quicksort_data_t* data,
+                     const state_t* state,
+                     blk_t blk,
+                     float* f1,
+                     float* f2)
+{
+	if (!data->warm || state->search_depth != 0)
+		return 0;
+	const uint64_t entry = *quicksort_warm_entry(data->warm, state, blk);
+	if (entry == QUICKSORT_WARM_UNSET)
+		return 0;
+	const uint32_t bits[2] = { (uint32_t)entry, (uint32_t)(entry >> 32) };
+	memcpy(f1, &bits[0], sizeof(float));
+	memcpy(f2, &bits[1], sizeof(float));
+	return 1;
+}
+
+void
+quicksort_warm_store(quicksort_data_t* data, const state_t* state, blk_t blk, float f1, float f2)
+{
+	assert(!isnan(f1) && !isnan(f2));
+	if (!data->warm || state->search_depth != 0 || f2 == 0.f)
+		return;
+	uint32_t bits[2];
+	memcpy(&bits[0], &f1, sizeof(float));
+	memcpy(&bits[1], &f2, sizeof(float));
+	*quicksort_warm_entry(data->warm, state, blk) = (uint64_t)bits[0] | (uint64_t)bits[1] << 32;
+}
+
+quicksort_cache_t
+quicksort_cache_new(size_t count)
+{
+	// Keep the table at most half full
+	size_t capacity = 16;
+	while (capacity < count * 2)
+		capacity *= 2;
+	quicksort_cache_t cache = {
+		.entries = arena_alloc(sizeof(quicksort_cache_entry_t) * capacity),
+		.capacity = capacity,
+		.size = 0,
+	};
+	for (size_t i = 0; i < capacity; ++i)
+		cache.entries[i] =
+		  (quicksort_cache_entry_t){ .key = 0, .cost = SIZE_MAX, .layout = 0, .lower = 0 };
+	return cache;
+}
+
+/** @brief Entry of @p key in @p cache, claiming an empty entry if it is missing */
+static quicksort_cache_entry_t*
+quicksort_cache_slot(quicksort_cache_t* cache, uint64_t key)
+{
+	size_t i = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & (cache->capacity - 1);
+	while (1) {
+		quicksort_cache_entry_t* const entry = &cache->entries[i];
+		uint64_t found = __atomic_load_n(&entry->key, __ATOMIC_ACQUIRE);
+		if (found == 0 &&
+		    __atomic_compare_exchange_n(
+		      &entry->key, &found, key, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+			__atomic_fetch_add(&cache->size, 1, __ATOMIC_RELAXED);
+			return entry;
+		}
+		if (found == key)
+			return entry;
+		i = (i + 1) & (cache->capacity - 1);
+	}
+}
+
+void
+quicksort_cache_reserve(quicksort_cache_t* cache, size_t count)
+{
+	if ((cache->size + count) * 2 <= cache->capacity)
+		return;
+	const quicksort_cache_t old = *cache;
+	*cache = quicksort_cache_new(old.size + count);
+	for (size_t i = 0; i < old.capacity; ++i) {
+		if (old.entries[i].key == 0)
+			continue;
+		quicksort_cache_entry_t* const entry = quicksort_cache_slot(cache, old.entries[i].key);
+		entry->cost = old.entries[i].cost;
+		entry->layout = old.entries[i].layout;
+		entry->lower = old.entries[i].lower;
+	}
+}
+
+quicksort_cache_entry_t*
+quicksort_cache_get(quicksort_cache_t* cache, size_t i1, size_t i2)
+{
+	assert(i1 < UINT32_MAX && i2 < UINT32_MAX);
+	const uint64_t key = ((uint64_t)i1 << 32 | (uint64_t)i2) + 1;
+	if ((__atomic_load_n(&cache->size, __ATOMIC_RELAXED) + 1) * 2 > cache->capacity)
+		quicksort_cache_reserve(cache, 1);
+	return quicksort_cache_slot(cache, key);
+}
+
 void
 quicksort_data_free(quicksort_data_t* data)
 {
+	free(data->tt);
+	free(data->warm);
 	for (size_t i = 0; i < data->plots_size; ++i) {
 		free(data->plots[i].data);
 		free(data->plots[i].desc);
@@ -0,0 +1,219 @@
+#include <fcntl.h>
+#include <quicksort/model.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** @brief Distances of the pattern database, `NULL` until loaded */
+static const uint8_t* blk_pdb = NULL;
+
+/** @brief Nodes expanded by a single search before giving up */
+#define BLK_IDA_NODES ((size_t)1 << 14)
+/** @brief Longest sequence searched */
+#define BLK_IDA_LONGEST 48
+
+int
+blk_pdb_load(const char* path)
+{
+	const int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 0;
+	size_t states = 0;
+	for (size_t n = BLK_SORT_MAX + 1; n <= BLK_PDB_SIZE; ++n)
+		states += model_states(n);
+	const size_t len = sizeof(blk_pdb_header_t) + states;
+	struct stat st;
+	if (fstat(fd, &st) || (size_t)st.st_size != len) {
+		close(fd);
+		return 0;
+	}
+	void* map = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return 0;
+
+	const blk_pdb_header_t* header = map;
+	if (memcmp(header->magic, BLK_PDB_MAGIC, sizeof(header->magic)) ||
+	    header->size != BLK_PDB_SIZE || header->states != states) {
+		munmap(map, len);
+		return 0;
+	}
+	blk_pdb = (const uint8_t*)(header + 1);
+	return 1;
+}
+
+typedef struct
+{
+	/** @brief Number of values */
+	size_t n;
+	/** @brief Distances of the model states of `min(n, BLK_PDB_SIZE)` values */
+	const uint8_t* table;
+	/** @brief Nodes left to expand */
+	size_t nodes;
+	/** @brief Length of the path found */
+	size_t len;
+	/** @brief Operations of the current path */
+	enum stack_op path[BLK_IDA_LONGEST];
+} ida_t;
+
+/** @brief Operation undoing each operation */
+static const enum stack_op ida_inverse[] = {
+	[STACK_OP_SA] = STACK_OP_SA,   [STACK_OP_SB] = STACK_OP_SB,   [STACK_OP_SS] = STACK_OP_SS,
+	[STACK_OP_PA] = STACK_OP_PB,   [STACK_OP_PB] = STACK_OP_PA,   [STACK_OP_RA] = STACK_OP_RRA,
+	[STACK_OP_RB] = STACK_OP_RRB,  [STACK_OP_RR] = STACK_OP_RRR,  [STACK_OP_RRA] = STACK_OP_RA,
+	[STACK_OP_RRB] = STACK_OP_RB,  [STACK_OP_RRR] = STACK_OP_RR,  [STACK_OP_NOP] = STACK_OP_NOP,
+};
+
+/**
+ * @brief Whether @p op following @p last is never part of a shortest sequence
+ *
+ * Besides undoing @p last, a pair of operations on different stacks is either merged
+ * into a single operation (e.g `ra, rb` is `rr`) or commutes, and only the order with
+ * A's operation first is searched. An operation on both stacks next to an inverse
+ * operation on a single stack (e.g `rr, rra`) is a single operation on the other stack.
+ */
+static int
+ida_redundant(enum stack_op last, enum stack_op op)
+{
+	if (op == ida_inverse[last])
+		return 1;
+	if ((last & STACK_OPERATOR__) == STACK_OP_PUSH__ || (op & STACK_OPERATOR__) == STACK_OP_PUSH__)
+		return 0;
+	const unsigned int a = last & STACK_OPERAND__;
+	const unsigned int b = op & STACK_OPERAND__;
+	if (a == STACK_OP_SEL_B__ && b == STACK_OP_SEL_A__)
+		return 1;
+	if (a == STACK_OP_SEL_A__ && b == STACK_OP_SEL_B__)
+		return (last & STACK_OPERATOR__) == (op & STACK_OPERATOR__);
+	return (a & b) && a != b && (ida_inverse[last] & STACK_OPERATOR__) == (op & STACK_OPERATOR__);
+}
+
+/** @brief Distances of the model states of @p n values, `n <= BLK_PDB_SIZE` */
+static const uint8_t*
+ida_table(size_t n)
+{
+	const uint8_t* table = blk_pdb;
+	for (size_t k = BLK_SORT_MAX + 1; k < n; ++k)
+		table += model_states(k);
+	return table;
+}
+
+/** @brief Largest distance of the projections of @p m on windows of consecutive values */
+static size_t
+ida_heuristic(const ida_t* ida, const model_t* m)
+{
+	if (ida->n <= BLK_PDB_SIZE)
+		return ida->table[model_index(m, ida->n)];
+
+	size_t h = 0;
+	for (size_t lo = 0; lo + BLK_PDB_SIZE <= ida->n; ++lo) {
+		model_t p;
+		for (size_t s = 0; s < SEG_COUNT; ++s) {
+			p.size[s] = 0;
+			for (size_t i = 0; i < m->size[s]; ++i)
+				if ((size_t)m->seg[s][i] - lo < BLK_PDB_SIZE)
+					p.seg[s][p.size[s]++] = (uint8_t)(m->seg[s][i] - lo);
+		}
+		const size_t d = ida->table[model_index(&p, BLK_PDB_SIZE)];
+		if (d > h)
+			h = d;
+	}
+	return h;
+}
+
+static int
+ida_sorted(const model_t* m, size_t n)
+{
+	if (m->size[SEG_A_TOP] != n)
+		return 0;
+	for (size_t i = 0; i < n; ++i)
+		if (m->seg[SEG_A_TOP][i] != i)
+			return 0;
+	return 1;
+}
+
+/**
+ * @brief Depth-first search of the paths from @p m of at most @p bound operations
+ *
+ * @return `0` if a path was found, stored in `ida->path`, otherwise the smallest
+ * estimated cost exceeding @p bound, or `SIZE_MAX` once out of nodes
+ */
+static size_t
+ida_search(ida_t* ida, const model_t* m, size_t g, size_t bound, enum stack_op last)
+{
+	const size_t f = g + ida_heuristic(ida, m);
+	if (f > bound)
+		return f;
+	if (ida_sorted(m, ida->n)) {
+		ida->len = g;
+		return 0;
+	}
+	if (ida->nodes == 0 || g == BLK_IDA_LONGEST)
+		return SIZE_MAX;
+	--ida->nodes;
+
+	size_t next = SIZE_MAX;
+	for (size_t i = 0; i < MODEL_OPS_LEN; ++i) {
+		const enum stack_op op = model_ops[i];
+		if (ida_redundant(last, op))
+			continue;
+		model_t child = *m;
+		if (!model_apply(&child, op))
+			continue;
+		ida->path[g] = op;
+		const size_t r = ida_search(ida, &child, g + 1, bound, op);
+		if (r == 0)
+			return 0;
+		if (r < next)
+			next = r;
+	}
+	return next;
+}
+
+int
+blk_sort_ida(state_t* state, blk_t blk)
+{
+	assert(blk.size > BLK_SORT_MAX && blk.size <= BLK_IDA_MAX);
+	// Evaluations are too many to search
+	if (!blk_pdb || (state->search_depth != 0 && blk.size > BLK_PDB_SIZE))
+		return 0;
+
+	// Relative order of the block's values
+	value_t values[BLK_IDA_MAX];
+	uint8_t perm[BLK_IDA_MAX];
+	blk_values(state, blk, values);
+	for (size_t i = 0; i < blk.size; ++i) {
+		size_t smaller = 0;
+		for (size_t j = 0; j < blk.size; ++j)
+			smaller += values[j] < values[i];
+		perm[i] = (uint8_t)smaller;
+	}
+
+	ida_t ida = {
+		.n = blk.size,
+		.table = ida_table(blk.size < BLK_PDB_SIZE ? blk.size : BLK_PDB_SIZE),
+		.nodes = BLK_IDA_NODES,
+	};
+	const model_t root = model_block(perm, blk.size, blk.dest);
+	size_t bound = ida_heuristic(&ida, &root);
+	// Evaluations only read the cost, which is exact
+	if (state->search_depth != 0) {
+		blk_skip_sort(state, blk, bound);
+		return 1;
+	}
+	while (1) {
+		const size_t r = ida_search(&ida, &root, 0, bound, STACK_OP_NOP);
+		if (r == 0)
+			break;
+		if (r == SIZE_MAX)
+			return 0;
+		bound = r;
+	}
+
+	for (size_t i = 0, run; i < ida.len; i += run) {
+		for (run = 1; i + run < ida.len && ida.path[i + run] == ida.path[i]; ++run)
+			;
+		state_op_n(state, ida.path[i], run);
+	}
+	return 1;
+}
@@ -0,0 +1,185 @@
+#ifndef MODEL_H
+#define MODEL_H
+
+/*
+ * The wall model of a block, shared by `tools/blk_sort_gen.c` and the exact solver.
+ *
+ * Values outside of the block are modeled as one wall per stack, which operations
+ * cannot move or go through. A stack is thus split in a top segment, the wall, and a
+ * bottom segment. Every sequence sorting a model state is valid regardless of what the
+ * walls hold, including when they are empty.
+ */
+#include <quicksort/quicksort.h>
+#include <string.h>
+
+/** @brief Segments of the wall model */
+enum
+{
+	SEG_A_TOP,
+	SEG_A_BOT,
+	SEG_B_TOP,
+	SEG_B_BOT,
+	SEG_COUNT,
+};
+
+/** @brief A state of the wall model, segments are stored in stack order (top first) */
+typedef struct
+{
+	uint8_t seg[SEG_COUNT][BLK_IDA_MAX];
+	uint8_t size[SEG_COUNT];
+} model_t;
+
+static const enum stack_op model_ops[] = {
+	STACK_OP_SA, STACK_OP_SB, STACK_OP_SS,  STACK_OP_PA,  STACK_OP_PB,  STACK_OP_RA,
+	STACK_OP_RB, STACK_OP_RR, STACK_OP_RRA, STACK_OP_RRB, STACK_OP_RRR,
+};
+
+enum
+{
+	MODEL_OPS_LEN = sizeof(model_ops) / sizeof(model_ops[0])
+};
+
+static inline size_t
+model_factorial(size_t n)
+{
+	return n < 2 ? 1 : n * model_factorial(n - 1);
+}
+
+/** @brief Number of ways to split @p n values into @p k segments */
+static inline size_t
+model_compositions(size_t n, size_t k)
+{
+	// Binomial (n + k - 1, k - 1)
+	size_t c = 1;
+	for (size_t i = 1; i < k; ++i)
+		c = c * (n + i) / i;
+	return c;
+}
+
+/** @brief Number of model states of @p n values */
+static inline size_t
+model_states(size_t n)
+{
+	return model_compositions(n, SEG_COUNT) * model_factorial(n);
+}
+
+/** @brief Lehmer rank of a permutation of `0..n-1`, as computed by `blk_perm_rank` */
+static inline size_t
+model_perm_rank(const uint8_t* perm, size_t n)
+{
+	size_t rank = 0;
+	for (size_t i = 0; i < n; ++i) {
+		size_t smaller = 0;
+		for (size_t j = i + 1; j < n; ++j)
+			smaller += perm[j] < perm[i];
+		rank = rank * (n - i) + smaller;
+	}
+	return rank;
+}
+
+/**
+ * @brief Index of a model state of @p n values, less than `model_states(n)`
+ *
+ * States are ordered by segment sizes, then by the rank of their concatenated values.
+ */
+static inline size_t
+model_index(const model_t* m, size_t n)
+{
+	uint8_t perm[BLK_IDA_MAX];
+	size_t len = 0;
+	size_t sizes = 0;
+	for (size_t s = 0; s < SEG_COUNT; ++s) {
+		// Count the size splits that come first, sizes of the last segment are implied
+		for (size_t v = 0; v < m->size[s] && s + 1 < SEG_COUNT; ++v)
+			sizes += model_compositions(n - len - v, SEG_COUNT - s - 1);
+		memcpy(perm + len, m->seg[s], m->size[s]);
+		len += m->size[s];
+	}
+	return sizes * model_factorial(n) + model_perm_rank(perm, n);
+}
+
+static inline void
+model_push_front(model_t* m, size_t s, uint8_t v)
+{
+	memmove(m->seg[s] + 1, m->seg[s], m->size[s]);
+	m->seg[s][0] = v;
+	++m->size[s];
+}
+
+static inline uint8_t
+model_pop_front(model_t* m, size_t s)
+{
+	const uint8_t v = m->seg[s][0];
+	memmove(m->seg[s], m->seg[s] + 1, --m->size[s]);
+	return v;
+}
+
+/** @brief Apply @p op to a single stack of the model, `0` if it would touch the wall */
+static inline int
+model_apply_stack(model_t* m, enum stack_op op, size_t top, size_t bot)
+{
+	uint8_t tmp;
+	switch (op & STACK_OPERATOR__) {
+		case STACK_OP_SWAP__:
+			if (m->size[top] < 2)
+				return 0;
+			tmp = m->seg[top][0];
+			m->seg[top][0] = m->seg[top][1];
+			m->seg[top][1] = tmp;
+			return 1;
+		case STACK_OP_ROTATE__:
+			if (m->size[top] < 1)
+				return 0;
+			tmp = model_pop_front(m, top);
+			m->seg[bot][m->size[bot]++] = tmp;
+			return 1;
+		case STACK_OP_REV_ROTATE__:
+			if (m->size[bot] < 1)
+				return 0;
+			tmp = m->seg[bot][--m->size[bot]];
+			model_push_front(m, top, tmp);
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/** @brief Apply @p op to the model, `0` if it would touch a wall */
+static inline int
+model_apply(model_t* m, enum stack_op op)
+{
+	if ((op & STACK_OPERATOR__) == STACK_OP_PUSH__) {
+		const size_t from = op == STACK_OP_PA ? SEG_B_TOP : SEG_A_TOP;
+		const size_t to = op == STACK_OP_PA ? SEG_A_TOP : SEG_B_TOP;
+		if (m->size[from] < 1)
+			return 0;
+		model_push_front(m, to, model_pop_front(m, from));
+		return 1;
+	}
+	if ((op & STACK_OP_SEL_A__) && !model_apply_stack(m, op, SEG_A_TOP, SEG_A_BOT))
+		return 0;
+	if ((op & STACK_OP_SEL_B__) && !model_apply_stack(m, op, SEG_B_TOP, SEG_B_BOT))
+		return 0;
+	return 1;
+}
+
+/** @brief Model state of a block at @p dest, `perm[i]` being its `i`-th value */
+static inline model_t
+model_block(const uint8_t* perm, size_t n, enum blk_dest dest)
+{
+	static const size_t segs[4] = {
+		[BLK_A_TOP] = SEG_A_TOP,
+		[BLK_A_BOT] = SEG_A_BOT,
+		[BLK_B_TOP] = SEG_B_TOP,
+		[BLK_B_BOT] = SEG_B_BOT,
+	};
+	model_t m;
+	memset(&m, 0, sizeof(m));
+	// Block positions start from the bottom for bottom locations
+	for (size_t i = 0; i < n; ++i)
+		m.seg[segs[dest]][(dest & BLK_POS__) == BLK_TOP__ ? i : n - i - 1] = perm[i];
+	m.size[segs[dest]] = (uint8_t)n;
+	return m;
+}
+
+#endif // MODEL_H
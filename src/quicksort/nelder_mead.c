@@ -1,4 +1,5 @@
 #include <math.h>
+#include <omp.h>
 #include <quicksort/quicksort.h>
 #include <strings.h>
 
@@ -8,37 +9,52 @@ quicksort_nm(quicksort_nm_t nm)
 	return (quicksort_data_t){
 		.nm = nm,
 		.sort = quicksort_nm_impl,
+		.tt = quicksort_tt_new(),
+		.warm = nm.warm_shrink != 0.f ? quicksort_warm_new() : NULL,
 		.plots = NULL,
 		.plots_size = 0,
 	};
 }
 
+/* Working state to evaluate pivots for `blk` on, see evaluate_pivots */
+static inline state_t
+evaluation_state(const state_t* state, blk_t blk)
+{
+	state_t work = blk_state(state, blk);
+	work.search_depth += 1;
+	return work;
+}
+
+/* Whether `work` reached `*bound`, which other threads may lower, `0` for NULL bounds */
 static inline int
-cmp(const void* x, const void* y)
+exceeded(const state_t* work, const size_t* bound)
 {
-	return *(const int*)x - *(const int*)y;
+	return bound && work->op_count >= __atomic_load_n(bound, __ATOMIC_RELAXED);
 }
 
+/* Evaluate pivots on `work`, which is left untouched, abandoning the evaluation with a
+ * `SIZE_MAX` cost once it cannot beat `*bound` (unless `bound` is NULL) */
 static inline size_t
 evaluate_pivots(quicksort_data_t* data,
-                const state_t* state,
+                state_t* work,
                 blk_t blk,
-                int p1,
-                int p2,
-                size_t depth_override)
+                value_t p1,
+                value_t p2,
+                size_t layout,
+                size_t depth_override,
+                const size_t* bound)
 {
-	state_t new = state_clone(state);
-
-	new.search_depth += 1;
+	const state_mark_t mark = state_mark(work);
 
 	// Split & Evaluate
-	const split_t split = blk_split(&new, blk, p1, p2);
-	quicksort_nm_impl(data, &new, split.bot, depth_override);
-	quicksort_nm_impl(data, &new, split.mid, depth_override);
-	quicksort_nm_impl(data, &new, split.top, depth_override);
-
-	const size_t cost = new.op_count;
-	state_destroy(&new);
+	const split_t split = blk_split(work, blk, p1, p2, layout);
+	// Parts are sorted to completion, so that the transposition table keeps their costs
+	const blk_t parts[3] = { split.bot, split.mid, split.top };
+	for (size_t i = 0; i < 3 && !exceeded(work, bound); ++i)
+		quicksort_nm_impl(data, work, parts[i], depth_override);
+
+	const size_t cost = exceeded(work, bound) ? SIZE_MAX : work->op_count;
+	state_rollback(work, mark);
 	return cost;
 }
 
@@ -78,18 +94,25 @@ plot_pivots(quicksort_data_t* data, state_t* state, blk_t blk, const int domain[
 	free(settings);
 
 	size_t i;
-#pragma omp parallel for schedule(dynamic) private(i) shared(plot)
-	for (i = 0; i < width * height; ++i) {
-		if (i % width == 0) {
-			printf("Progress (%f)\n", (float)(size_t)(i / width) / (float)height);
-		}
-		const int p1 = (int)(i % width);
-		const int p2 = (int)(i / width);
-		if (p2 < p1)
-			continue;
+#pragma omp parallel private(i) shared(plot)
+	{
+		const arena_mark_t mark = arena_mark();
+		state_t work = evaluation_state(state, blk);
+#pragma omp for schedule(dynamic)
+		for (i = 0; i < width * height; ++i) {
+			if (i % width == 0) {
+				printf("Progress (%f)\n", (float)(size_t)(i / width) / (float)height);
+			}
+			const int p1 = (int)(i % width);
+			const int p2 = (int)(i / width);
+			if (p2 < p1)
+				continue;
 
-		const size_t cost = evaluate_pivots(data, state, blk, p1, p2, SIZE_MAX);
-		plot[(size_t)p1 + (height - (size_t)p2 - 1) * width] = cost;
+			const size_t cost =
+			  evaluate_pivots(data, &work, blk, (value_t)p1, (value_t)p2, 0, SIZE_MAX, NULL);
+			plot[(size_t)p1 + (height - (size_t)p2 - 1) * width] = cost;
+		}
+		arena_reset(mark);
 	}
 	quicksort_data_add_plot(data,
 	                        (quicksort_plot_t){
@@ -108,6 +131,14 @@ uv_to_f(float u, float v, float* out_f1, float* out_f2)
 	*out_f2 = fminf(1.f, u + (1.f - u) * v);
 }
 
+/* Map a f1 <= f2 pair back to (u, v), inverse of uv_to_f */
+static inline void
+f_to_uv(float f1, float f2, float* out_u, float* out_v)
+{
+	*out_u = f1;
+	*out_v = f1 < 1.f ? (f2 - f1) / (1.f - f1) : 0.f;
+}
+
 /* Map pivot floating point value to a size_t in the blk_t range */
 static inline size_t
 f_to_index(float f, size_t n)
@@ -121,31 +152,164 @@ f_to_index(float f, size_t n)
 	return idx;
 }
 
-/* Evaluate pivot index pair (i1, i2) */
+/* Evaluate pivot index pair (i1, i2) with each of its first `layouts` layouts that can
+ * beat `best_cost`. Evaluations are abandoned once they cannot beat the pair's best
+ * layout, nor `*bound` (which other threads may lower meanwhile) unless it is NULL.
+ * Pairs whose layouts were skipped against these external bounds are only known not to
+ * beat them: their lower bound is returned and cached in place of their cost */
 static size_t
+evaluate_index_bounded(quicksort_data_t* data,
+                       state_t* work,
+                       blk_t blk,
+                       const value_t* tmp_buf,
+                       size_t i1,
+                       size_t i2,
+                       quicksort_cache_t* cache,
+                       size_t n,
+                       size_t layouts,
+                       size_t best_cost,
+                       const size_t* bound,
+                       size_t depth_override)
+{
+	assert(i1 < n && i2 < n && i1 <= i2);
+
+	// Speculative steps and neighborhood scans fill the cache concurrently
+	quicksort_cache_entry_t* const e = quicksort_cache_get(cache, i1, i2);
+	const size_t cached = __atomic_load_n(&e->cost, __ATOMIC_RELAXED);
+	if (cached != SIZE_MAX)
+		return cached;
+	if (e->lower != 0 && e->lower >= best_cost)
+		return e->lower;
+
+	const value_t p1 = tmp_buf[i1];
+	const value_t p2 = tmp_buf[i2];
+	size_t cost = SIZE_MAX;
+	size_t best_layout = 0;
+	size_t lower = SIZE_MAX;
+	for (size_t layout = 0; layout < layouts; ++layout) {
+		const size_t split_bound = work->op_count + blk_split_bound(blk, i1, i2, layout);
+		if (split_bound >= cost)
+			continue;
+		if (split_bound >= best_cost) {
+			lower = split_bound < lower ? split_bound : lower;
+			continue;
+		}
+		const size_t* const limit =
+		  bound && __atomic_load_n(bound, __ATOMIC_RELAXED) < cost ? bound : &cost;
+		const size_t c = evaluate_pivots(data, work, blk, p1, p2, layout, depth_override, limit);
+		// Bounds only decrease, the layout costs at least the current one
+		if (c == SIZE_MAX && limit == bound) {
+			const size_t reached = __atomic_load_n(bound, __ATOMIC_RELAXED);
+			lower = reached < lower ? reached : lower;
+		} else if (c < cost) {
+			cost = c;
+			best_layout = layout;
+		}
+	}
+
+	// Skipped layouts may beat the others, which then only bound the pair's cost
+	if (lower < cost) {
+		if (lower > e->lower)
+			e->lower = lower;
+		return lower;
+	}
+#pragma omp critical(evaluate_index)
+	{
+		e->layout = best_layout;
+		__atomic_store_n(&e->cost, cost, __ATOMIC_RELAXED);
+	}
+	return cost;
+}
+
+/* Evaluate pivot index pair (i1, i2) without bound, see evaluate_index_bounded. Simplex
+ * steps compare costs past the best vertex, which must thus be exact */
+static inline size_t
 evaluate_index_cached(quicksort_data_t* data,
-                      const state_t* state,
+                      state_t* work,
                       blk_t blk,
-                      const int* tmp_buf,
+                      const value_t* tmp_buf,
                       size_t i1,
                       size_t i2,
-                      size_t* cache,
+                      quicksort_cache_t* cache,
                       size_t n,
-                      size_t best_cost,
+                      size_t layouts,
                       size_t depth_override)
 {
-	assert(i1 < n && i2 < n && i1 <= i2);
+	return evaluate_index_bounded(
+	  data, work, blk, tmp_buf, i1, i2, cache, n, layouts, SIZE_MAX, NULL, depth_override);
+}
 
-	if (state->op_count >= best_cost)
-		return SIZE_MAX;
-	const size_t key = i1 * n + i2;
-	if (cache[key] != SIZE_MAX)
-		return cache[key];
+/* Points evaluated by a step of the simplex */
+enum
+{
+	STEP_REFLECT,
+	STEP_EXPAND,
+	STEP_CONTRACT_OUT,
+	STEP_CONTRACT_IN,
+	STEP_COUNT,
+};
+
+/* Clamp point `x` to [0,1] and map it to its pivot indices */
+static inline void
+point_indices(float x[2], size_t n, size_t pair[2])
+{
+	x[0] = x[0] < 0.0f ? 0.0f : (x[0] > 1.0f ? 1.0f : x[0]);
+	x[1] = x[1] < 0.0f ? 0.0f : (x[1] > 1.0f ? 1.0f : x[1]);
+	float f1, f2;
+	uv_to_f(x[0], x[1], &f1, &f2);
+	pair[0] = f_to_index(f1, n);
+	pair[1] = f_to_index(f2, n);
+	if (pair[1] < pair[0])
+		pair[1] = pair[0];
+}
 
-	const int p1 = tmp_buf[i1];
-	const int p2 = tmp_buf[i2];
-	cache[key] = evaluate_pivots(data, state, blk, p1, p2, depth_override);
-	return cache[key];
+/* Evaluate `count` pivot index pairs at once, each thread on its own working state.
+ * Identical pairs are evaluated once. The team keeps its default size, threads without
+ * a pair idling, as OpenMP retires and respawns workers whenever teams change size */
+static void
+evaluate_concurrently(quicksort_data_t* data,
+                      const state_t* state,
+                      blk_t blk,
+                      const value_t* tmp_buf,
+                      quicksort_cache_t* cache,
+                      size_t n,
+                      size_t layouts,
+                      size_t depth_override,
+                      const size_t (*pairs)[2],
+                      size_t count,
+                      size_t* costs)
+{
+	size_t first[STEP_COUNT];
+	assert(count <= STEP_COUNT);
+	for (size_t i = 0; i < count; ++i) {
+		first[i] = 0;
+		while (pairs[first[i]][0] != pairs[i][0] || pairs[first[i]][1] != pairs[i][1])
+			++first[i];
+	}
+
+	// Threads insert concurrently, which the cache must not grow during
+	quicksort_cache_reserve(cache, count);
+	size_t i;
+#pragma omp parallel for schedule(dynamic) private(i)
+	for (i = 0; i < count; ++i) {
+		if (first[i] != i)
+			continue;
+		const arena_mark_t mark = arena_mark();
+		state_t local = evaluation_state(state, blk);
+		costs[i] = evaluate_index_cached(data,
+		                                 &local,
+		                                 blk,
+		                                 tmp_buf,
+		                                 pairs[i][0],
+		                                 pairs[i][1],
+		                                 cache,
+		                                 n,
+		                                 layouts,
+		                                 depth_override);
+		arena_reset(mark);
+	}
+	for (i = 0; i < count; ++i)
+		costs[i] = costs[first[i]];
 }
 
 /* Compute maximum distance of two edges of the simplex */
@@ -164,54 +328,29 @@ simplex_diameter(const float simplex[3][2])
 	return max;
 }
 
-/** @brief Compute the currest best cost */
-static inline size_t
-best_cost(const size_t fvals[3])
-{
-	size_t best = SIZE_MAX;
-	for (size_t i = 0; i < 3; ++i) {
-		if (fvals[i] < best)
-			best = fvals[i];
-	}
-	return best;
-}
-
-void
-optimize_pivots(quicksort_data_t* data,
-                const state_t* state,
-                blk_t blk,
-                const int* tmp_buf,
-                float* out_f1,
-                float* out_f2)
+/* Run Nelder-Mead from the simplex at (`base_u`, `base_v`) of size `scale`, evaluating
+ * on `work`. Returns the cost of the best vertex, stored in `vertex` */
+static size_t
+nelder_mead(quicksort_data_t* data,
+            const state_t* state,
+            state_t* work,
+            blk_t blk,
+            const value_t* tmp_buf,
+            quicksort_cache_t* cache,
+            size_t layouts,
+            float base_u,
+            float base_v,
+            float scale,
+            float vertex[2])
 {
-	assert(data);
-	/* quick exits for degenerate sizes */
 	const size_t n = blk.size;
-	if (n == 0) {
-		*out_f1 = *out_f2 = 0.0f;
-		return;
-	}
-	if (n == 1) {
-		*out_f1 = *out_f2 = 0.0f;
-		return;
-	}
-
-	// Initialize cache
-	size_t* cache = NULL;
-	cache = xmalloc(sizeof(size_t) * n * n);
-	for (size_t i = 0; i < n * n; ++i)
-		cache[i] = SIZE_MAX;
-
-	float base_u = 0.25f;
-	float base_v = 0.75f;
-
 	float simplex[3][2];
 	simplex[0][0] = base_u;
 	simplex[0][1] = base_v;
-	simplex[1][0] = fminf(1.0f, base_u + data->nm.initial_scale);
+	simplex[1][0] = fminf(1.0f, base_u + scale);
 	simplex[1][1] = base_v;
 	simplex[2][0] = base_u;
-	simplex[2][1] = fminf(1.0f, base_v + data->nm.initial_scale);
+	simplex[2][1] = fminf(1.0f, base_v + scale);
 
 	/* Nelder-Mead coefficients */
 	const float alpha = 1.0f; /* reflection */
@@ -228,10 +367,18 @@ optimize_pivots(quicksort_data_t* data,
 		size_t idx2 = f_to_index(f2, n);
 		if (idx2 < idx1)
 			idx2 = idx1; /* safety */
-		fvals[i] = evaluate_index_cached(
-		  data, state, blk, tmp_buf, idx1, idx2, cache, n, best_cost(fvals), SIZE_MAX);
+		fvals[i] =
+		  evaluate_index_cached(data, work, blk, tmp_buf, idx1, idx2, cache, n, layouts, SIZE_MAX);
 	}
 
+	// Speculating only pays off with threads to spare, which nested searches lack
+	const int speculative = data->nm.speculative && !omp_in_parallel();
+	size_t pairs[STEP_COUNT][2];
+	/* Evaluate the pivot indices of a step on the single working state */
+#define STEP_EVALUATE(step)                                                                        \
+	evaluate_index_cached(                                                                         \
+	  data, work, blk, tmp_buf, pairs[step][0], pairs[step][1], cache, n, layouts, depth)
+
 	/* Main NM loop */
 	for (size_t iter = 0; iter < data->nm.max_iters; ++iter) {
 		/* sort simplex vertices by fvals ascending (0 = best) */
@@ -254,7 +401,6 @@ optimize_pivots(quicksort_data_t* data,
 				simplex[best][1] = tmpv;
 			}
 		}
-		const size_t best = best_cost(fvals);
 		const float diameter = simplex_diameter(simplex);
 		size_t depth = data->nm.max_depth;
 		//if (diameter < 0.01f)
@@ -268,37 +414,34 @@ optimize_pivots(quicksort_data_t* data,
 		const float centroid[2] = { 0.5f * (simplex[0][0] + simplex[1][0]),
 			                        0.5f * (simplex[0][1] + simplex[1][1]) };
 
-		/* reflection: xr = centroid + alpha*(centroid - x_worst) */
+		/* candidate points, evaluated one after the other unless speculating */
 		float xr[2] = { centroid[0] + alpha * (centroid[0] - simplex[2][0]),
 			            centroid[1] + alpha * (centroid[1] - simplex[2][1]) };
-		/* clamp xr to [0,1] */
-		xr[0] = xr[0] < 0.0f ? 0.0f : (xr[0] > 1.0f ? 1.0f : xr[0]);
-		xr[1] = xr[1] < 0.0f ? 0.0f : (xr[1] > 1.0f ? 1.0f : xr[1]);
-
-		float xr_f1, xr_f2;
-		uv_to_f(xr[0], xr[1], &xr_f1, &xr_f2);
-		size_t xr_i1 = f_to_index(xr_f1, n);
-		size_t xr_i2 = f_to_index(xr_f2, n);
-		if (xr_i2 < xr_i1)
-			xr_i2 = xr_i1;
-
-		const size_t fr =
-		  evaluate_index_cached(data, state, blk, tmp_buf, xr_i1, xr_i2, cache, n, best, depth);
+		point_indices(xr, n, pairs[STEP_REFLECT]);
+		float xe[2] = { centroid[0] + gamma * (xr[0] - centroid[0]),
+			            centroid[1] + gamma * (xr[1] - centroid[1]) };
+		point_indices(xe, n, pairs[STEP_EXPAND]);
+		// Between centroid and xr, outside contraction
+		float xoc[2] = { centroid[0] + rho * (xr[0] - centroid[0]),
+			             centroid[1] + rho * (xr[1] - centroid[1]) };
+		point_indices(xoc, n, pairs[STEP_CONTRACT_OUT]);
+		// Between centroid and worst, inside contraction
+		float xic[2] = { centroid[0] + rho * (simplex[2][0] - centroid[0]),
+			             centroid[1] + rho * (simplex[2][1] - centroid[1]) };
+		point_indices(xic, n, pairs[STEP_CONTRACT_IN]);
+
+		size_t costs[STEP_COUNT];
+		if (speculative)
+			evaluate_concurrently(
+			  data, state, blk, tmp_buf, cache, n, layouts, depth, pairs, STEP_COUNT, costs);
+		else
+			costs[STEP_REFLECT] = STEP_EVALUATE(STEP_REFLECT);
+
+		const size_t fr = costs[STEP_REFLECT];
+		int shrink = 0;
 		// Expansion
 		if (fr < fvals[0]) {
-			float xe[2] = { centroid[0] + gamma * (xr[0] - centroid[0]),
-				            centroid[1] + gamma * (xr[1] - centroid[1]) };
-			xe[0] = xe[0] < 0.0f ? 0.0f : (xe[0] > 1.0f ? 1.0f : xe[0]);
-			xe[1] = xe[1] < 0.0f ? 0.0f : (xe[1] > 1.0f ? 1.0f : xe[1]);
-			float xe_f1, xe_f2;
-			uv_to_f(xe[0], xe[1], &xe_f1, &xe_f2);
-			size_t xe_i1 = f_to_index(xe_f1, n);
-			size_t xe_i2 = f_to_index(xe_f2, n);
-			if (xe_i2 < xe_i1)
-				xe_i2 = xe_i1;
-			size_t fe = evaluate_index_cached(
-			  data, state, blk, tmp_buf, xe_i1, xe_i2, cache, n, best, depth);
-
+			const size_t fe = speculative ? costs[STEP_EXPAND] : STEP_EVALUATE(STEP_EXPAND);
 			if (fe < fr) {
 				/* accept expansion */
 				simplex[2][0] = xe[0];
@@ -318,100 +461,99 @@ optimize_pivots(quicksort_data_t* data,
 			simplex[2][1] = xr[1];
 			fvals[2] = fr;
 		}
-		// Contraction
+		// Outside contraction
+		else if (fr < fvals[2]) {
+			const size_t fc =
+			  speculative ? costs[STEP_CONTRACT_OUT] : STEP_EVALUATE(STEP_CONTRACT_OUT);
+			if (fc <= fr) {
+				simplex[2][0] = xoc[0];
+				simplex[2][1] = xoc[1];
+				fvals[2] = fc;
+			} else
+				shrink = 1;
+		}
+		// Inside contraction
 		else {
-			// Between centroid and xr, outside contraction
-			if (fr < fvals[2]) {
-				float xc[2] = { centroid[0] + rho * (xr[0] - centroid[0]),
-					            centroid[1] + rho * (xr[1] - centroid[1]) };
-				xc[0] = xc[0] < 0.0f ? 0.0f : (xc[0] > 1.0f ? 1.0f : xc[0]);
-				xc[1] = xc[1] < 0.0f ? 0.0f : (xc[1] > 1.0f ? 1.0f : xc[1]);
-				float xc_f1, xc_f2;
-				uv_to_f(xc[0], xc[1], &xc_f1, &xc_f2);
-				const size_t xc_i1 = f_to_index(xc_f1, n);
-				size_t xc_i2 = f_to_index(xc_f2, n);
-				if (xc_i2 < xc_i1)
-					xc_i2 = xc_i1;
-				const size_t fc = evaluate_index_cached(
-				  data, state, blk, tmp_buf, xc_i1, xc_i2, cache, n, best, depth);
-				if (fc <= fr) {
-					simplex[2][0] = xc[0];
-					simplex[2][1] = xc[1];
-					fvals[2] = fc;
-				}
-				// Shrink
-				else {
-					for (size_t i = 1; i < 3; ++i) {
-						simplex[i][0] = simplex[0][0] + sigma * (simplex[i][0] - simplex[0][0]);
-						simplex[i][1] = simplex[0][1] + sigma * (simplex[i][1] - simplex[0][1]);
-						simplex[i][0] = simplex[i][0] < 0.0f
-						                  ? 0.0f
-						                  : (simplex[i][0] > 1.0f ? 1.0f : simplex[i][0]);
-						simplex[i][1] = simplex[i][1] < 0.0f
-						                  ? 0.0f
-						                  : (simplex[i][1] > 1.0f ? 1.0f : simplex[i][1]);
-						float fi1, fi2;
-						uv_to_f(simplex[i][0], simplex[i][1], &fi1, &fi2);
-						const size_t idi1 = f_to_index(fi1, n);
-						size_t idi2 = f_to_index(fi2, n);
-						if (idi2 < idi1)
-							idi2 = idi1;
-						fvals[i] = evaluate_index_cached(
-						  data, state, blk, tmp_buf, idi1, idi2, cache, n, best, depth);
-					}
-				}
-			}
-			// Between centroin and worst, inside contraction
-			else {
-				float xc[2] = { centroid[0] + rho * (simplex[2][0] - centroid[0]),
-					            centroid[1] + rho * (simplex[2][1] - centroid[1]) };
-				xc[0] = xc[0] < 0.0f ? 0.0f : (xc[0] > 1.0f ? 1.0f : xc[0]);
-				xc[1] = xc[1] < 0.0f ? 0.0f : (xc[1] > 1.0f ? 1.0f : xc[1]);
-				float xc_f1, xc_f2;
-				uv_to_f(xc[0], xc[1], &xc_f1, &xc_f2);
-				const size_t xc_i1 = f_to_index(xc_f1, n);
-				size_t xc_i2 = f_to_index(xc_f2, n);
-				if (xc_i2 < xc_i1)
-					xc_i2 = xc_i1;
-				const size_t fc = evaluate_index_cached(
-				  data, state, blk, tmp_buf, xc_i1, xc_i2, cache, n, best, depth);
-				if (fc < fvals[2]) {
-					simplex[2][0] = xc[0];
-					simplex[2][1] = xc[1];
-					fvals[2] = fc;
-				}
-				// Shrink
-				else {
-					for (size_t i = 1; i < 3; ++i) {
-						simplex[i][0] = simplex[0][0] + sigma * (simplex[i][0] - simplex[0][0]);
-						simplex[i][1] = simplex[0][1] + sigma * (simplex[i][1] - simplex[0][1]);
-						simplex[i][0] = simplex[i][0] < 0.0f
-						                  ? 0.0f
-						                  : (simplex[i][0] > 1.0f ? 1.0f : simplex[i][0]);
-						simplex[i][1] = simplex[i][1] < 0.0f
-						                  ? 0.0f
-						                  : (simplex[i][1] > 1.0f ? 1.0f : simplex[i][1]);
-						float fi1, fi2;
-						uv_to_f(simplex[i][0], simplex[i][1], &fi1, &fi2);
-						const size_t idi1 = f_to_index(fi1, n);
-						size_t idi2 = f_to_index(fi2, n);
-						if (idi2 < idi1)
-							idi2 = idi1;
-						fvals[i] = evaluate_index_cached(
-						  data, state, blk, tmp_buf, idi1, idi2, cache, n, best, depth);
-					}
-				}
+			const size_t fc =
+			  speculative ? costs[STEP_CONTRACT_IN] : STEP_EVALUATE(STEP_CONTRACT_IN);
+			if (fc < fvals[2]) {
+				simplex[2][0] = xic[0];
+				simplex[2][1] = xic[1];
+				fvals[2] = fc;
+			} else
+				shrink = 1;
+		}
+
+		// Shrink towards the best point
+		if (shrink) {
+			for (size_t i = 1; i < 3; ++i) {
+				simplex[i][0] = simplex[0][0] + sigma * (simplex[i][0] - simplex[0][0]);
+				simplex[i][1] = simplex[0][1] + sigma * (simplex[i][1] - simplex[0][1]);
+				point_indices(simplex[i], n, pairs[i - 1]);
 			}
+			if (speculative)
+				evaluate_concurrently(
+				  data, state, blk, tmp_buf, cache, n, layouts, depth, pairs, 2, fvals + 1);
+			else
+				for (size_t i = 1; i < 3; ++i)
+					fvals[i] = STEP_EVALUATE(i - 1);
 		}
 	}
+#undef STEP_EVALUATE
 
 	// Choose best point
 	size_t best_idx = 0;
 	for (size_t i = 1; i < 3; ++i)
 		if (fvals[i] < fvals[best_idx])
 			best_idx = i;
-	const float best_u = simplex[best_idx][0];
-	const float best_v = simplex[best_idx][1];
+	vertex[0] = simplex[best_idx][0];
+	vertex[1] = simplex[best_idx][1];
+	return fvals[best_idx];
+}
+
+void
+optimize_pivots(quicksort_data_t* data,
+                const state_t* state,
+                blk_t blk,
+                const value_t* tmp_buf,
+                float* out_f1,
+                float* out_f2,
+                size_t* out_layout)
+{
+	assert(data);
+	/* quick exits for degenerate sizes */
+	const size_t n = blk.size;
+	*out_layout = 0;
+	if (n == 0) {
+		*out_f1 = *out_f2 = 0.0f;
+		return;
+	}
+	if (n == 1) {
+		*out_f1 = *out_f2 = 0.0f;
+		return;
+	}
+
+	// Sized for the initial simplex and a few iterations, growing as pivots are evaluated
+	quicksort_cache_t cache = quicksort_cache_new(32);
+	// Layouts multiply evaluations, and are only searched for blocks being sorted
+	const size_t layouts = state->search_depth == 0 ? blk_layouts(blk.dest) : 1;
+	// Candidates are evaluated on a single working state, rolled back after each of them
+	state_t work = evaluation_state(state, blk);
+
+	// Similar blocks are mostly split alike, so searches start from their pivots with a
+	// smaller simplex
+	float base_u = .25f, base_v = .75f;
+	float scale = data->nm.initial_scale;
+	float warm_f1, warm_f2;
+	if (quicksort_warm_probe(data, state, blk, &warm_f1, &warm_f2)) {
+		f_to_uv(warm_f1, warm_f2, &base_u, &base_v);
+		scale /= data->nm.warm_shrink;
+	}
+
+	float vertex[2];
+	nelder_mead(data, state, &work, blk, tmp_buf, &cache, layouts, base_u, base_v, scale, vertex);
+	const float best_u = vertex[0];
+	const float best_v = vertex[1];
 	float best_f1, best_f2;
 	uv_to_f(best_u, best_v, &best_f1, &best_f2);
 	const size_t best_i1 = f_to_index(best_f1, n);
@@ -425,28 +567,55 @@ optimize_pivots(quicksort_data_t* data,
 	const int radius = (int)data->nm.final_radius;
 	if (radius != 0) {
 		size_t best = evaluate_index_cached(
-		  data, state, blk, tmp_buf, best_i1, best_i2, cache, n, fvals[best_idx], SIZE_MAX);
+		  data, &work, blk, tmp_buf, best_i1, best_i2, &cache, n, layouts, SIZE_MAX);
 		const int N = (2 * radius + 1) * (2 * radius + 1);
+		// Ties go to the first neighbor, whatever the order threads reach them in: they are
+		// only abandoned once worse than the best cost, bounded by `limit`
+		int final_i = N / 2;
+		size_t limit = best == SIZE_MAX ? SIZE_MAX : best + 1;
+		// Threads insert concurrently, which the cache must not grow during
+		quicksort_cache_reserve(&cache, (size_t)N);
 		int i;
-#pragma omp parallel for schedule(static)                                                        \
-  shared(best, cache, final_i1, final_i2, state, tmp_buf, blk, data, n) private(i)
-		for (i = 0; i < N; ++i) {
-			const int di1 = i / (2 * radius + 1) - radius;
-			const int di2 = i % (2 * radius + 1) - radius;
-			if ((size_t)-di1 > best_i1 || (size_t)-di2 > best_i2)
-				continue;
-			const size_t ni1 = (size_t)((int)best_i1 + di1);
-			const size_t ni2 = (size_t)((int)best_i2 + di2);
-			if (ni1 >= n || ni2 >= n || ni2 < ni1)
-				continue;
-			const size_t c =
-			  evaluate_index_cached(data, state, blk, tmp_buf, ni1, ni2, cache, n, SIZE_MAX, SIZE_MAX);
+#pragma omp parallel shared(best, limit, cache, final_i, final_i1, final_i2, state, tmp_buf, blk, \
+                              data, n) private(i)
+		{
+			// Each thread evaluates on its own working state
+			const arena_mark_t mark = arena_mark();
+			state_t local = evaluation_state(state, blk);
+#pragma omp for schedule(static)
+			for (i = 0; i < N; ++i) {
+				const int di1 = i / (2 * radius + 1) - radius;
+				const int di2 = i % (2 * radius + 1) - radius;
+				if ((size_t)-di1 > best_i1 || (size_t)-di2 > best_i2)
+					continue;
+				const size_t ni1 = (size_t)((int)best_i1 + di1);
+				const size_t ni2 = (size_t)((int)best_i2 + di2);
+				if (ni1 >= n || ni2 >= n || ni2 < ni1)
+					continue;
+				// Only the best pivots matter, others are abandoned as soon as they
+				// cannot beat them
+				const size_t c = evaluate_index_bounded(data,
+				                                        &local,
+				                                        blk,
+				                                        tmp_buf,
+				                                        ni1,
+				                                        ni2,
+				                                        &cache,
+				                                        n,
+				                                        layouts,
+				                                        __atomic_load_n(&limit, __ATOMIC_RELAXED),
+				                                        &limit,
+				                                        SIZE_MAX);
 #pragma omp critical
-			if (c < best) {
-				best = c;
-				final_i1 = ni1;
-				final_i2 = ni2;
+				if (c < best || (c == best && i < final_i)) {
+					best = c;
+					__atomic_store_n(&limit, c + 1, __ATOMIC_RELAXED);
+					final_i = i;
+					final_i1 = ni1;
+					final_i2 = ni2;
+				}
 			}
+			arena_reset(mark);
 		}
 		if (state->search_depth == 0 && blk.size == 500)
 			printf("converged %zu %zu %zu\n", final_i1, final_i2, best);
@@ -454,34 +623,36 @@ optimize_pivots(quicksort_data_t* data,
 
 	*out_f1 = fmaxf(0.f, (float)final_i1 / (float)(n - 1));
 	*out_f2 = fminf(1.f, (float)final_i2 / (float)(n - 1));
-	free(cache);
+	*out_layout = quicksort_cache_get(&cache, final_i1, final_i2)->layout;
+	quicksort_warm_store(data, state, blk, *out_f1, *out_f2);
 }
 
 static inline void
 get_pivots(quicksort_data_t* data,
            const state_t* state,
            blk_t blk,
-           int* pivots,
+           value_t* pivots,
+           size_t* layout,
            size_t depth_override)
 {
-	int* tmp_buf = xmalloc(sizeof(int) * blk.size);
-	for (size_t i = 0; i < blk.size; ++i)
-		tmp_buf[i] = blk_value(state, blk.dest, i);
-	qsort(tmp_buf, blk.size, sizeof(int), cmp);
-
-	// Use (Q1, Q3) as pivots
+	// Use (Q1, Q3) as pivots, selected without sorting the block
+	*layout = 0;
 	if ((depth_override == SIZE_MAX && state->search_depth > data->nm.max_depth) ||
 	    (depth_override != SIZE_MAX && state->search_depth > depth_override)) {
-		pivots[0] = tmp_buf[(33 * blk.size) / 100];
-		pivots[1] = tmp_buf[(66 * blk.size) / 100];
-	} else {
-		float f1, f2;
-		optimize_pivots(data, state, blk, tmp_buf, &f1, &f2);
-		assert(f1 <= f2);
-		pivots[0] = tmp_buf[(size_t)(f1 * (float)(blk.size - 1) + .5f)];
-		pivots[1] = tmp_buf[(size_t)(f2 * (float)(blk.size - 1) + .5f)];
+		const size_t ranks[2] = { (33 * blk.size) / 100, (66 * blk.size) / 100 };
+		blk_select(state, blk, ranks, 2, pivots);
+		return;
 	}
-	free(tmp_buf);
+
+	const arena_mark_t mark = arena_mark();
+	value_t* tmp_buf = arena_alloc(sizeof(value_t) * blk.size);
+	blk_sorted_values(state, blk, tmp_buf);
+	float f1, f2;
+	optimize_pivots(data, state, blk, tmp_buf, &f1, &f2, layout);
+	assert(f1 <= f2);
+	pivots[0] = tmp_buf[(size_t)(f1 * (float)(blk.size - 1) + .5f)];
+	pivots[1] = tmp_buf[(size_t)(f2 * (float)(blk.size - 1) + .5f)];
+	arena_reset(mark);
 }
 
 void
@@ -504,19 +675,35 @@ quicksort_nm_impl(quicksort_data_t* data, state_t* state, blk_t blk, size_t dept
 	if (blk.size == 1) {
 		blk_move(state, blk.dest, BLK_A_TOP);
 		return;
-	} else if (blk.size == 2) {
-		blk_sort_2(state, blk);
+	} else if (blk.size <= BLK_SORT_MAX) {
+		blk_sort_small(state, blk);
 		return;
-	} else if (blk.size == 3) {
-		blk_sort_3(state, blk);
+	}
+	if (blk.size <= BLK_IDA_MAX && blk_sort_ida(state, blk))
 		return;
+	if (blk_sort_presorted(state, blk))
+		return;
+
+	// Reuse the cost of an identical block sorted during search
+	uint64_t key = 0;
+	const size_t op_count = state->op_count;
+	if (state->search_depth != 0) {
+		size_t cost;
+		key = quicksort_tt_key(state, blk, depth_override);
+		if (quicksort_tt_probe(data, key, &cost)) {
+			blk_skip_sort(state, blk, cost);
+			return;
+		}
 	}
 
 	// Choose pivots & split
-	int pivots[2];
-	get_pivots(data, state, blk, pivots, depth_override);
-	const split_t split = blk_split(state, blk, pivots[0], pivots[1]);
+	value_t pivots[2];
+	size_t layout;
+	get_pivots(data, state, blk, pivots, &layout, depth_override);
+	const split_t split = blk_split(state, blk, pivots[0], pivots[1], layout);
 	quicksort_nm_impl(data, state, split.bot, depth_override);
 	quicksort_nm_impl(data, state, split.mid, depth_override);
 	quicksort_nm_impl(data, state, split.top, depth_override);
+	if (state->search_depth != 0)
+		quicksort_tt_store(data, key, state->op_count - op_count);
 }
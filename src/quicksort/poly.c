@@ -10,21 +10,20 @@ quicksort_poly(quicksort_poly_t poly)
 	return (quicksort_data_t){
 		.poly = poly,
 		.sort = quicksort_poly_impl,
+		.tt = quicksort_tt_new(),
+		.warm = NULL,
 		.plots = NULL,
 		.plots_size = 0,
 	};
 }
 
-static inline int
-cmp(const void* x, const void* y)
-{
-	return *(const int*)x - *(const int*)y;
-}
-
 typedef struct
 {
-	int* tmp_buf;
-	size_t* cache;
+	value_t* tmp_buf;
+	/** @brief Costs and best layouts of the pivots evaluated */
+	quicksort_cache_t cache;
+	/** @brief Number of layouts tried for every pivot pair, see @ref search_layouts */
+	size_t layouts_size;
 	float coeffs[10];
 } poly;
 
@@ -51,51 +50,145 @@ get_plot_desc(const quicksort_data_t* data, state_t* state, blk_t blk, const cha
 	return desc;
 }
 
+/* Working state to evaluate pivots for `blk` on, see cost_function */
+static inline state_t
+evaluation_state(const state_t* state, blk_t blk)
+{
+	state_t work = blk_state(state, blk);
+	work.search_depth += 1;
+	return work;
+}
+
+/* Whether `work` reached `*bound`, which other threads may lower, `0` for NULL bounds */
+static inline int
+exceeded(const state_t* work, const size_t* bound)
+{
+	return bound && work->op_count >= __atomic_load_n(bound, __ATOMIC_RELAXED);
+}
+
+/* Evaluate pivots on `work`, which is left untouched, abandoning the evaluation with a
+ * `SIZE_MAX` cost once it cannot beat `*bound` */
 static inline size_t
 cost_function(quicksort_data_t* data,
-              state_t* state,
+              state_t* work,
               blk_t blk,
-              int p1,
-              int p2,
-              size_t depth_override)
+              value_t p1,
+              value_t p2,
+              size_t layout,
+              size_t depth_override,
+              const size_t* bound)
 {
-	state_t new = state_clone(state);
-	new.search_depth += 1;
-
-	const split_t split = blk_split(&new, blk, p1, p2);
-	quicksort_poly_impl(data, &new, split.bot, depth_override);
-	quicksort_poly_impl(data, &new, split.mid, depth_override);
-	quicksort_poly_impl(data, &new, split.top, depth_override);
-	const size_t cost = new.op_count;
-	state_destroy(&new);
+	const state_mark_t mark = state_mark(work);
+
+	const split_t split = blk_split(work, blk, p1, p2, layout);
+	// Parts are sorted to completion, so that the transposition table keeps their costs
+	const blk_t parts[3] = { split.bot, split.mid, split.top };
+	for (size_t i = 0; i < 3 && !exceeded(work, bound); ++i)
+		quicksort_poly_impl(data, work, parts[i], depth_override);
+	const size_t cost = exceeded(work, bound) ? SIZE_MAX : work->op_count;
+	state_rollback(work, mark);
 	return cost;
 }
 
+/* Number of layouts to search when choosing pivots for `blk`: layouts multiply
+ * evaluations, and are only searched for blocks being sorted */
+static inline size_t
+search_layouts(const state_t* state, blk_t blk)
+{
+	return state->search_depth == 0 ? blk_layouts(blk.dest) : 1;
+}
+
+/* Cost of the best of the first `layouts` layouts for pivots, skipping or abandoning
+ * layouts that cannot beat `*best`, which other threads may lower meanwhile, unless
+ * `best` is NULL. Sets `*lower` to a lower bound of the cost of the layouts skipped or
+ * abandoned against `*best`, `SIZE_MAX` when none was */
+static inline size_t
+best_layout(quicksort_data_t* data,
+            state_t* work,
+            blk_t blk,
+            const value_t* tmp_buf,
+            size_t i1,
+            size_t i2,
+            size_t layouts,
+            const size_t* best,
+            size_t* layout,
+            size_t* lower,
+            size_t depth_override)
+{
+	size_t cost = SIZE_MAX;
+	*lower = SIZE_MAX;
+	for (size_t l = 0; l < layouts; ++l) {
+		// Evaluations are abandoned once they cannot beat the best layout either
+		const size_t* const bound =
+		  best && __atomic_load_n(best, __ATOMIC_RELAXED) < cost ? best : &cost;
+		const size_t split_bound = work->op_count + blk_split_bound(blk, i1, i2, l);
+		if (split_bound >= __atomic_load_n(bound, __ATOMIC_RELAXED)) {
+			if (bound == best && split_bound < *lower)
+				*lower = split_bound;
+			continue;
+		}
+		const size_t c =
+		  cost_function(data, work, blk, tmp_buf[i1], tmp_buf[i2], l, depth_override, bound);
+		// Bounds only decrease, the layout costs at least the current one
+		if (c == SIZE_MAX && bound == best) {
+			const size_t reached = __atomic_load_n(best, __ATOMIC_RELAXED);
+			*lower = reached < *lower ? reached : *lower;
+		} else if (c < cost) {
+			cost = c;
+			*layout = l;
+		}
+	}
+	return cost;
+}
+
+/* Cost of pivots, see best_layout. Pivots whose layouts were skipped against `*best` are
+ * only known not to beat it: their lower bound is returned and cached in place of their
+ * cost */
 static inline size_t
 cost_cached(quicksort_data_t* data,
-            state_t* state,
+            state_t* work,
             blk_t blk,
             poly* poly,
             size_t i1,
             size_t i2,
+            const size_t* best,
             size_t depth_override)
 {
 	if (i2 >= blk.size)
 		i2 = blk.size - 1;
 	if (i1 >= i2)
 		i1 = i2;
-	const size_t id = i1 + i2 * blk.size;
-	if (poly->cache[id] == SIZE_MAX) {
-		const int p1 = poly->tmp_buf[i1];
-		const int p2 = poly->tmp_buf[i2];
-		poly->cache[id] = cost_function(data, state, blk, p1, p2, depth_override);
+	quicksort_cache_entry_t* const e = quicksort_cache_get(&poly->cache, i1, i2);
+	if (e->cost != SIZE_MAX)
+		return e->cost;
+	if (best && e->lower != 0 && e->lower >= __atomic_load_n(best, __ATOMIC_RELAXED))
+		return e->lower;
+	size_t layout = 0, lower;
+	const size_t cost = best_layout(data,
+	                                work,
+	                                blk,
+	                                poly->tmp_buf,
+	                                i1,
+	                                i2,
+	                                poly->layouts_size,
+	                                best,
+	                                &layout,
+	                                &lower,
+	                                depth_override);
+	// Skipped layouts may beat the others, which then only bound the pair's cost
+	if (lower < cost) {
+		if (lower > e->lower)
+			e->lower = lower;
+		return lower;
 	}
-	return poly->cache[id];
+	e->layout = layout;
+	e->cost = cost;
+	return cost;
 }
 
 static float
 sample_smoothed(quicksort_data_t* data,
-                state_t* state,
+                state_t* work,
                 blk_t blk,
                 poly* poly,
                 size_t ci1,
@@ -129,7 +222,8 @@ sample_smoothed(quicksort_data_t* data,
 		if ((size_t)ni1 > (size_t)ni2)
 			continue; // triangular constraint
 		const double cost =
-		  (double)cost_cached(data, state, blk, poly, (size_t)ni1, (size_t)ni2, depth_override);
+		  (double)cost_cached(
+		    data, work, blk, poly, (size_t)ni1, (size_t)ni2, NULL, depth_override);
 		sum += cost;
 		++count;
 	}
@@ -249,17 +343,17 @@ poly_eval(const poly* poly, float u, float v)
 }
 
 poly
-build_poly(quicksort_data_t* data, state_t* state, blk_t blk, size_t depth_override, int* tmp_buf)
+build_poly(quicksort_data_t* data, state_t* state, blk_t blk, size_t depth_override, value_t* tmp_buf)
 {
 	poly poly = {
 		.tmp_buf = tmp_buf,
-		.cache = xmalloc(sizeof(size_t) * blk.size * blk.size),
+		// Smoothed samples evaluate up to 13 pivots each
+		.cache = quicksort_cache_new(30 * 13),
+		.layouts_size = search_layouts(state, blk),
 		.coeffs = { 0.f },
 	};
 
 	bzero(poly.coeffs, sizeof(float) * 10);
-	for (size_t i = 0; i < blk.size * blk.size; ++i)
-		poly.cache[i] = SIZE_MAX;
 
 	const size_t n = blk.size;
 
@@ -268,15 +362,16 @@ build_poly(quicksort_data_t* data, state_t* state, blk_t blk, size_t depth_overr
 	uint64_t rng = 0xdeadbeefcafe1234ULL ^ (uint64_t)blk.size ^ ((uint64_t)blk.dest << 7);
 	const size_t actual_pts = triangular_lhs(30, us, vs, &rng);
 
-	// Build samples
+	// Build samples, rolling back a single working state after each evaluation
 	const int box_radius = 4;
 	float ys[30];
+	state_t work = evaluation_state(state, blk);
 
 	for (size_t k = 0; k < actual_pts; ++k) {
 		// Map normalized [0,1] coords to index space
 		const size_t ci1 = (size_t)(us[k] * (float)(n - 1) + 0.5f);
 		const size_t ci2 = (size_t)(vs[k] * (float)(n - 1) + 0.5f);
-		ys[k] = sample_smoothed(data, state, blk, &poly, ci1, ci2, box_radius, depth_override);
+		ys[k] = sample_smoothed(data, &work, blk, &poly, ci1, ci2, box_radius, depth_override);
 	}
 
 	// Normalize y values for numerical stability (mean=0, std=1)
@@ -397,7 +492,8 @@ scan_neighborhood(quicksort_data_t* data,
                   blk_t blk,
                   poly* poly,
                   size_t* i1,
-                  size_t* i2)
+                  size_t* i2,
+                  size_t* layout)
 {
 	size_t best = SIZE_MAX;
 	size_t best_pivots[2] = { *i2, *i2 };
@@ -405,38 +501,69 @@ scan_neighborhood(quicksort_data_t* data,
 	const size_t radius = data->poly.neighborhood_radius;
 	const size_t side = radius * 2 + 1;
 	size_t i;
-#pragma omp parallel for schedule(dynamic) private(i) shared(poly)
-	for (i = 0; i < (2 * radius + 1) * (2 * radius + 1); ++i) {
-		const int p1 = (int)*i1 - (int)radius + (int)(i % side);
-		const int p2 = (int)*i2 - (int)radius + (int)(i / side);
-		if (p1 < 0 || p2 < 0 || p2 < p1 || (size_t)p1 >= blk.size || (size_t)p2 >= blk.size)
-			continue;
-
-		const size_t cost = cost_cached(
-		  data, state, blk, poly, (size_t)p1, (size_t)p2, data->poly.neighborhood_depth);
+	// Threads insert concurrently, which the cache must not grow during
+	quicksort_cache_reserve(&poly->cache, side * side);
+#pragma omp parallel private(i) shared(poly)
+	{
+		// Each thread evaluates on its own working state
+		const arena_mark_t mark = arena_mark();
+		state_t work = evaluation_state(state, blk);
+#pragma omp for schedule(dynamic)
+		for (i = 0; i < (2 * radius + 1) * (2 * radius + 1); ++i) {
+			const int p1 = (int)*i1 - (int)radius + (int)(i % side);
+			const int p2 = (int)*i2 - (int)radius + (int)(i / side);
+			if (p1 < 0 || p2 < 0 || p2 < p1 || (size_t)p1 >= blk.size ||
+			    (size_t)p2 >= blk.size)
+				continue;
+			// Layouts that cannot beat the best pivots are skipped
+			const size_t cost = cost_cached(data,
+			                                &work,
+			                                blk,
+			                                poly,
+			                                (size_t)p1,
+			                                (size_t)p2,
+			                                &best,
+			                                data->poly.neighborhood_depth);
 #pragma omp critical
-		if (cost < best) {
-			best = cost;
-			best_pivots[0] = (size_t)p1;
-			best_pivots[1] = (size_t)p2;
+			if (cost < best) {
+				__atomic_store_n(&best, cost, __ATOMIC_RELAXED);
+				best_pivots[0] = (size_t)p1;
+				best_pivots[1] = (size_t)p2;
+			}
 		}
+		arena_reset(mark);
 	}
 	if (blk.size == 500)
 		printf("best = %zu\n", best);
 	*i1 = best_pivots[0];
 	*i2 = best_pivots[1];
+	*layout = best != SIZE_MAX ? quicksort_cache_get(&poly->cache, *i1, *i2)->layout : 0;
 }
 
 void
-get_pivots(quicksort_data_t* data, state_t* state, blk_t blk, int* pivots, size_t depth_override)
+get_pivots(quicksort_data_t* data,
+           state_t* state,
+           blk_t blk,
+           value_t* pivots,
+           size_t* layout,
+           size_t depth_override)
 {
-	int* tmp_buf = xmalloc(sizeof(int) * blk.size);
-	for (size_t i = 0; i < blk.size; ++i)
-		tmp_buf[i] = blk_value(state, blk.dest, i);
-	qsort(tmp_buf, blk.size, sizeof(int), cmp);
+	*layout = 0;
+	const size_t ranks[2] = {
+		(size_t)(.25f * (float)(blk.size - 1) + .5f),
+		(size_t)(.60f * (float)(blk.size - 1) + .5f),
+	};
+	blk_select(state, blk, ranks, 2, pivots);
+
+	// Past the search depth, quantiles are selected without sorting the block
+	const int search = state->search_depth <= data->poly.max_depth ||
+	                   (state->search_depth < depth_override && depth_override != SIZE_MAX);
+	if (blk.size >= data->poly.bruteforce_size && !search)
+		return;
 
-	pivots[0] = tmp_buf[(size_t)(.25f * (float)(blk.size - 1) + .5f)];
-	pivots[1] = tmp_buf[(size_t)(.60f * (float)(blk.size - 1) + .5f)];
+	const arena_mark_t mark = arena_mark();
+	value_t* tmp_buf = arena_alloc(sizeof(value_t) * blk.size);
+	blk_sorted_values(state, blk, tmp_buf);
 
 	// Bruteforce
 	if (blk.size < data->poly.bruteforce_size) {
@@ -449,23 +576,44 @@ get_pivots(quicksort_data_t* data, state_t* state, blk_t blk, int* pivots, size_
 			plot = xmalloc(sizeof(size_t) * blk.size * blk.size);
 			bzero(plot, sizeof(size_t) * blk.size * blk.size);
 		}
-#pragma omp parallel for schedule(dynamic) private(i) shared(data, state)
-		for (i = 0; i < blk.size * blk.size; ++i) {
-			const int p1 = tmp_buf[i % blk.size];
-			const int p2 = tmp_buf[i / blk.size];
-			if (p2 <= p1)
-				continue;
-			const size_t cost = cost_function(data, state, blk, p1, p2, depth_override);
-			if (plot)
-				plot[i % blk.size + (blk.size - i / blk.size - 1) * blk.size] = cost;
+#pragma omp parallel private(i) shared(data, state)
+		{
+			// Each thread evaluates on its own working state
+			const arena_mark_t thread_mark = arena_mark();
+			state_t work = evaluation_state(state, blk);
+#pragma omp for schedule(dynamic)
+			for (i = 0; i < blk.size * blk.size; ++i) {
+				const value_t p1 = tmp_buf[i % blk.size];
+				const value_t p2 = tmp_buf[i / blk.size];
+				if (p2 <= p1)
+					continue;
+				// Skip layouts that cannot beat the best pivots, unless they are plotted
+				size_t l = 0, lower;
+				const size_t cost =
+				  best_layout(data,
+				              &work,
+				              blk,
+				              tmp_buf,
+				              i % blk.size,
+				              i / blk.size,
+				              search_layouts(state, blk),
+				              plot ? NULL : &best,
+				              &l,
+				              &lower,
+				              depth_override);
+				if (plot)
+					plot[i % blk.size + (blk.size - i / blk.size - 1) * blk.size] = cost;
 #pragma omp critical
-			if (cost < best) {
-				best = cost;
-				pivots[0] = p1;
-				pivots[1] = p2;
-				best_idx[0] = i % blk.size;
-				best_idx[1] = i / blk.size;
+				if (cost < best) {
+					__atomic_store_n(&best, cost, __ATOMIC_RELAXED);
+					pivots[0] = p1;
+					pivots[1] = p2;
+					*layout = l;
+					best_idx[0] = i % blk.size;
+					best_idx[1] = i / blk.size;
+				}
 			}
+			arena_reset(thread_mark);
 		}
 		if (plot) {
 			quicksort_plot_t* p =
@@ -486,8 +634,7 @@ get_pivots(quicksort_data_t* data, state_t* state, blk_t blk, int* pivots, size_
 		}
 	}
 	// Compute poly surrogate & minimize
-	else if (state->search_depth <= data->poly.max_depth ||
-	         (state->search_depth < depth_override && depth_override != SIZE_MAX)) {
+	else {
 		poly poly = build_poly(data, state, blk, depth_override, tmp_buf);
 		const float domain[4] = { 0.0f, 1.0f, 0.0f, 1.0f };
 		float u, v;
@@ -498,15 +645,14 @@ get_pivots(quicksort_data_t* data, state_t* state, blk_t blk, int* pivots, size_
 		size_t i2 = (size_t)(v * (float)(blk.size - 1) + .5f);
 		if (blk.size == 500)
 			printf("%zu %zu\n", i1, i2);
-		scan_neighborhood(data, state, blk, &poly, &i1, &i2);
+		scan_neighborhood(data, state, blk, &poly, &i1, &i2, layout);
 		if (blk.size == 500)
 			printf("%zu %zu\n", i1, i2);
 		pivots[0] = tmp_buf[i1];
 		pivots[1] = tmp_buf[i2];
-		free(poly.cache);
 	}
 
-	free(tmp_buf);
+	arena_reset(mark);
 }
 
 void
@@ -529,19 +675,35 @@ quicksort_poly_impl(quicksort_data_t* data, state_t* state, blk_t blk, size_t de
 	if (blk.size == 1) {
 		blk_move(state, blk.dest, BLK_A_TOP);
 		return;
-	} else if (blk.size == 2) {
-		blk_sort_2(state, blk);
+	} else if (blk.size <= BLK_SORT_MAX) {
+		blk_sort_small(state, blk);
+		return;
+	}
+	if (blk.size <= BLK_IDA_MAX && blk_sort_ida(state, blk))
 		return;
-	} else if (blk.size == 3) {
-		blk_sort_3(state, blk);
+	if (blk_sort_presorted(state, blk))
 		return;
+
+	// Reuse the cost of an identical block sorted during search
+	uint64_t key = 0;
+	const size_t op_count = state->op_count;
+	if (state->search_depth != 0) {
+		size_t cost;
+		key = quicksort_tt_key(state, blk, depth_override);
+		if (quicksort_tt_probe(data, key, &cost)) {
+			blk_skip_sort(state, blk, cost);
+			return;
+		}
 	}
 
 	// Choose pivots & split
-	int pivots[2];
-	get_pivots(data, state, blk, pivots, depth_override);
-	const split_t split = blk_split(state, blk, pivots[0], pivots[1]);
+	value_t pivots[2];
+	size_t layout;
+	get_pivots(data, state, blk, pivots, &layout, depth_override);
+	const split_t split = blk_split(state, blk, pivots[0], pivots[1], layout);
 	quicksort_poly_impl(data, state, split.bot, depth_override);
 	quicksort_poly_impl(data, state, split.mid, depth_override);
 	quicksort_poly_impl(data, state, split.top, depth_override);
+	if (state->search_depth != 0)
+		quicksort_tt_store(data, key, state->op_count - op_count);
 }
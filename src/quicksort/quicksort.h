@@ -57,8 +57,64 @@ typedef struct
  *
  * @return The value at @p pos in @p blk
  */
-int
+value_t
 blk_value(const state_t* state, enum blk_dest blk, size_t pos);
+/**
+ * @brief Get the values of a block, in block order
+ *
+ * A block is at most two contiguous runs of its stack's ring, which are copied at once
+ * instead of dispatching on the block's location for every value.
+ *
+ * @param state State
+ * @param blk Block
+ * @param out Destination buffer of `blk.size` values, `out[i]` is the value at position
+ * `i` in @p blk
+ */
+void
+blk_values(const state_t* state, blk_t blk, value_t* out);
+/**
+ * @brief Get the values of a block, sorted
+ *
+ * Values are distinct ranks, so they are sorted with a counting pass over the block's
+ * value range instead of a comparison sort. Blocks holding a contiguous range of ranks
+ * are filled from their minimum directly.
+ *
+ * @param state State
+ * @param blk Block
+ * @param out Destination buffer of `blk.size` values
+ */
+void
+blk_sorted_values(const state_t* state, blk_t blk, value_t* out);
+/**
+ * @brief Get the values of given ranks within a block
+ *
+ * This is O(size) when @p blk holds a contiguous range of ranks, as every block made by
+ * splitting the input does, and falls back to @ref blk_sorted_values otherwise.
+ *
+ * @param state State
+ * @param blk Block
+ * @param ranks @p count ranks, each less than `blk.size`
+ * @param count Number of ranks
+ * @param out Set to the value of each rank, the `ranks[i]`-th smallest value of @p blk
+ */
+void
+blk_select(const state_t* state, blk_t blk, const size_t* ranks, size_t count, value_t* out);
+/**
+ * @brief Create a minimal state to evaluate the cost of sorting a block
+ *
+ * The returned state only holds @p blk's values, at the same location, plus one
+ * sentinel for every stack that holds values outside of @p blk. Sorting never reads or
+ * moves values outside of the sorted block, and only compares stack sizes with block
+ * sizes, so it emits the same operations on the returned state as on @p state.
+ *
+ * @param state State
+ * @param blk Block
+ *
+ * @return A scratch state holding @p blk, with @p state's `op_count` and `search_depth`,
+ * see @ref state_scratch
+ */
+state_t
+blk_state(const state_t* state, blk_t blk);
 /**
  * @brief Moves the value from one location to another
  *
@@ -71,25 +127,109 @@ blk_value(const state_t* state, enum blk_dest blk, size_t pos);
 void
 blk_move(state_t* state, enum blk_dest from, enum blk_dest to);
 /**
- * @brief Sort a block of two element onto A's top
+ * @brief Largest block sorted by @ref blk_sort_small
+ */
+#define BLK_SORT_MAX 6
+/**
+ * @brief Sort a small block onto A's top
  *
- * Block `blk` will be moved to A's top, sorted
+ * Block `blk` will be moved to A's top, sorted, with the shortest sequence of
+ * operations that never moves values outside of the block. Sequences are precomputed
+ * for every permutation by `tools/blk_sort_gen.c`, and looked up by the block's rank.
  *
  * @param state State
- * @param blk A block of 2 elements
+ * @param blk A block of 2 to `BLK_SORT_MAX` elements
  */
 void
-blk_sort_2(state_t* state, blk_t blk);
+blk_sort_small(state_t* state, blk_t blk);
+
+/** @brief Largest block sorted by @ref blk_sort_ida */
+#define BLK_IDA_MAX 9
+/** @brief Largest number of values in the states of the pattern database */
+#define BLK_PDB_SIZE 8
+/** @brief Magic number of pattern database files */
+#define BLK_PDB_MAGIC "BLKPDB01"
+
 /**
- * @brief Sort a block of three element onto A's top
+ * @brief Header of a pattern database file
  *
- * Block `blk` will be moved to A's top, sorted
+ * It is followed by the distance to the sorted state of every wall model state (see
+ * `src/quicksort/model.h`) of `BLK_SORT_MAX + 1` values, then of one more value, up to
+ * `BLK_PDB_SIZE` values, one byte per state.
+ */
+typedef struct
+{
+	/** @brief @ref BLK_PDB_MAGIC, without its terminator */
+	char magic[8];
+	/** @brief @ref BLK_PDB_SIZE of the generator */
+	uint32_t size;
+	/** @brief Number of states, of every size */
+	uint32_t states;
+} blk_pdb_header_t;
+
+/**
+ * @brief Map the pattern database used by @ref blk_sort_ida
+ *
+ * The database is generated by `blk_sort_gen pdb` and mapped read-only for the lifetime
+ * of the program, so loading it takes no time and every thread shares its pages.
+ *
+ * @param path Path to the database
+ *
+ * @return 1 on success, `0` if the file is missing or was generated with other settings
+ */
+int
+blk_pdb_load(const char* path);
+/**
+ * @brief Sort a block onto A's top with the fewest operations, using IDA*
+ *
+ * Like @ref blk_sort_small, only values of the block are moved. Blocks of up to
+ * `BLK_PDB_SIZE` values have their exact distance in the pattern database, and follow
+ * decreasing distances. Larger blocks use the largest distance among their windows of
+ * `BLK_PDB_SIZE` consecutive ranks as heuristic: sorting the block sorts every window,
+ * which never takes more operations than sorting the block.
+ *
+ * During search, blocks of up to `BLK_PDB_SIZE` values only look their distance up (see
+ * @ref blk_skip_sort) and larger blocks are not searched.
+ *
+ * The search is given a fixed budget of nodes, and leaves @p state unchanged when it
+ * runs out, as when no database is loaded.
  *
  * @param state State
- * @param blk A block of 3 elements
+ * @param blk A block of `BLK_SORT_MAX + 1` to `BLK_IDA_MAX` values
+ *
+ * @return 1 if @p blk was sorted, `0` otherwise
+ */
+int
+blk_sort_ida(state_t* state, blk_t blk);
+
+/**
+ * @brief Move a block onto A's top, accounting for a known sorting cost
+ *
+ * This stands for sorting @p blk on evaluation states, which are only ever read for
+ * their op count and rolled back: values are moved onto A's top in O(size), unsorted,
+ * and the op count is set as if sorting took @p cost operations.
+ *
+ * @param state Marked state, see @ref state_mark
+ * @param blk Block
+ * @param cost Number of operations sorting @p blk takes
  */
 void
-blk_sort_3(state_t* state, blk_t blk);
+blk_skip_sort(state_t* state, blk_t blk, size_t cost);
+/**
+ * @brief Sort a block that is already ordered
+ *
+ * Blocks whose values are already in sorted order, or in reverse order, only need to be
+ * pushed and rotated onto A's top, e.g a block sorted in reverse order on B's top only
+ * takes a `pa` per value. Blocks filling their stack that are a rotation of such an
+ * order are rotated first. Checking takes a single pass over the block.
+ *
+ * @param state State
+ * @param blk A block, with its location normalized
+ *
+ * @return 1 if @p blk was sorted, `0` if it is not ordered
+ */
+int
+blk_sort_presorted(state_t* state, blk_t blk);
 
 typedef struct
 {
@@ -98,21 +238,128 @@ typedef struct
 	blk_t bot;
 } split_t;
 
+/** @brief Largest number of layouts of a split, see @ref blk_layouts */
+#define BLK_LAYOUTS_MAX 6
+/**
+ * @brief Number of layouts of a split of a block at @p dest
+ *
+ * A layout assigns the three locations other than @p dest to the blocks of a split.
+ * Blocks are sorted onto A's top from `bot` to `top`, so A's top can only receive `bot`:
+ * any other block there would be buried under the blocks sorted before it. This leaves
+ * every permutation of locations when splitting from A's top, and two otherwise.
+ *
+ * Layout `0` always sends `bot` to A, and `mid` to A's bottom when splitting from B.
+ *
+ * @param dest Location of the block to split
+ *
+ * @return The number of layouts, valid layouts are lower
+ */
+size_t
+blk_layouts(enum blk_dest dest);
+
 /**
  * @brief Split a block into three blocks using a pair of pivots
  *
+ * A move ending with a rotation of the other stack (e.g `pb, rb`) holds the rotation
+ * back until the next operation: if that is a rotation of the block's stack in the same
+ * direction, both are emitted as a single `rr`.
+ *
  * @param state State
  * @param blk Block to split
  * @param p1 First pivot
  * @param p2 Second pivot `p1 <= p2`
+ * @param layout Locations of the resulting blocks, see @ref blk_layouts
  *
  * @retutrn Three blocks made from splitting @p blk
  */
 split_t
-blk_split(state_t* state, blk_t blk, int p1, int p2);
+blk_split(state_t* state, blk_t blk, value_t p1, value_t p2, size_t layout);
+/**
+ * @brief Blocks resulting from a split, without splitting
+ *
+ * Values are distinct, so splitting on the @p i1 -th and @p i2 -th smallest values of a
+ * block always sends `i1`, `i2 - i1` and `size - i2` values to the top, middle and
+ * bottom blocks.
+ *
+ * @param blk Block to split
+ * @param i1 Index of the first pivot among @p blk's sorted values
+ * @param i2 Index of the second pivot `i1 <= i2`
+ * @param layout Locations of the resulting blocks, see @ref blk_layouts
+ *
+ * @return The blocks @ref blk_split would return
+ */
+split_t
+blk_split_sizes(blk_t blk, size_t i1, size_t i2, size_t layout);
+/**
+ * @brief Number of operations @ref blk_split takes before fusing rotations, in O(1)
+ *
+ * Every value costs its @ref blk_move to its part's location, rotations included since
+ * runs of rotations count one operation per value. Fusing rotations into `rr` saves up
+ * to one operation per value moved to the bottom of the other stack.
+ *
+ * @param blk Block to split
+ * @param i1 Index of the first pivot among @p blk's sorted values
+ * @param i2 Index of the second pivot `i1 <= i2`
+ * @param layout Locations of the resulting blocks, see @ref blk_layouts
+ */
+size_t
+blk_split_cost(blk_t blk, size_t i1, size_t i2, size_t layout);
+/**
+ * @brief Lower bound of the operations splitting and sorting a block, in O(1)
+ *
+ * This is @ref blk_split_cost less the most rotations the split can fuse, plus one push
+ * per value left in B by the split: sorting the resulting blocks takes at least that
+ * many operations.
+ *
+ * @param blk Block to split
+ * @param i1 Index of the first pivot among @p blk's sorted values
+ * @param i2 Index of the second pivot `i1 <= i2`
+ * @param layout Locations of the resulting blocks, see @ref blk_layouts
+ */
+size_t
+blk_split_bound(blk_t blk, size_t i1, size_t i2, size_t layout);
 
 typedef struct quicksort_data_t quicksort_data_t;
 
+/**
+ * @brief An entry of the transposition table
+ *
+ * Entries are read and written by every search thread without locks: `check` holds
+ * the entry's key xor'ed with its cost, so that an entry torn by concurrent writes no
+ * longer matches its key and is treated as a miss.
+ */
+typedef struct
+{
+	/** @brief Key xor cost */
+	uint64_t check;
+	/** @brief Number of operations sorting the block took */
+	uint64_t cost;
+} quicksort_tt_entry_t;
+
+/** @brief Number of entries of the transposition table, a power of two */
+#define QUICKSORT_TT_SIZE ((size_t)1 << 20)
+
+/** @brief Block size classes with their own warm starts, one per power of two */
+#define QUICKSORT_WARM_SIZES 16
+/** @brief Unset warm start entry, a pair of NaN fractions */
+#define QUICKSORT_WARM_UNSET UINT64_MAX
+
+/**
+ * @brief Pivots last chosen for similar blocks, which pivot searches start from
+ *
+ * Blocks are similar when sorted from the same location, with sizes within the same
+ * power of two. Only the sequential top-level search uses warm starts: nested searches
+ * run concurrently, and their costs must only depend on their block for the
+ * transposition table to share them (see @ref quicksort_tt_key). Entries pack both pivot
+ * fractions as `float` bits. Unset entries hold @ref QUICKSORT_WARM_UNSET, which no pair
+ * of fractions packs into.
+ */
+typedef struct
+{
+	/** @brief Packed pivot fractions by location and size class */
+	uint64_t entries[4][QUICKSORT_WARM_SIZES];
+} quicksort_warm_t;
+
 /** @brief Nelder-Mead settings */
 typedef struct
 {
@@ -121,6 +368,9 @@ typedef struct
 	float tol;           /* Simplex radius tolerance in normalized [0,1] space, e.g. 1e-3f */
 	float initial_scale; /* Initial simplex scale (fraction of [0,1]), e.g. 0.05f */
 	size_t final_radius; /* Final search radius */
+	int speculative;     /* Evaluate every candidate point of a step at once, in parallel */
+	float warm_shrink;   /* Initial scale divisor of searches started from the pivots of similar
+	                        blocks (see @ref quicksort_warm_t), 0 to start them from scratch */
 } quicksort_nm_t;
 
 /** @brief Create quicksort data for Nelder-Mead */
@@ -174,11 +424,143 @@ struct quicksort_data_t
 		quicksort_poly_t poly;
 	};
 	void (*sort)(quicksort_data_t*, state_t*, blk_t, size_t);
+	/** @brief Costs of the blocks sorted during search, see @ref quicksort_tt_probe */
+	quicksort_tt_entry_t* tt;
+	/** @brief Pivots chosen for similar blocks, see @ref quicksort_warm_probe */
+	quicksort_warm_t* warm;
 
 	quicksort_plot_t* plots;
 	size_t plots_size;
 };
 
+/** @brief Allocate an empty transposition table */
+quicksort_tt_entry_t*
+quicksort_tt_new(void);
+/**
+ * @brief Transposition table key of a block
+ *
+ * The number of operations sorting a block takes only depends on the relative order of
+ * its values, on its normalized location, on whether other values share its stack or
+ * fill the other stack (see @ref blk_state), and on the search depth and depth override
+ * it is sorted with.
+ *
+ * @param state State
+ * @param blk Block, with its location normalized
+ * @param depth_override Depth override the block is sorted with
+ *
+ * @return A non-zero key for @p blk
+ */
+uint64_t
+quicksort_tt_key(const state_t* state, blk_t blk, size_t depth_override);
+/**
+ * @brief Look up the cost of sorting a block
+ *
+ * @param data Quicksort data
+ * @param key Key of the block, see @ref quicksort_tt_key
+ * @param cost Set to the cost of sorting the block on hits
+ *
+ * @return `1` on hits, `0` otherwise
+ */
+int
+quicksort_tt_probe(const quicksort_data_t* data, uint64_t key, size_t* cost);
+/**
+ * @brief Store the cost of sorting a block, replacing any previous entry
+ *
+ * @param data Quicksort data
+ * @param key Key of the block, see @ref quicksort_tt_key
+ * @param cost Number of operations sorting the block took
+ */
+void
+quicksort_tt_store(quicksort_data_t* data, uint64_t key, size_t cost);
+
+/** @brief Allocate an empty warm start table */
+quicksort_warm_t*
+quicksort_warm_new(void);
+/**
+ * @brief Look up the pivots last chosen for a block similar to @p blk
+ *
+ * @param data Quicksort data
+ * @param state State
+ * @param blk Block, with its location normalized
+ * @param f1 Set to the first pivot's fraction on hits
+ * @param f2 Set to the second pivot's fraction on hits
+ *
+ * @return `1` on hits, `0` otherwise or for nested searches
+ */
+int
+quicksort_warm_probe(const quicksort_data_t* data,
+                     const state_t* state,
+                     blk_t blk,
+                     float* f1,
+                     float* f2);
+/**
+ * @brief Remember the pivots chosen for @p blk, replacing those of similar blocks
+ *
+ * Splits sending every value to the bottom block are specific to their block and are
+ * not remembered, neither are the pivots of nested searches.
+ *
+ * @param data Quicksort data
+ * @param state State
+ * @param blk Block, with its location normalized
+ * @param f1 First pivot's fraction
+ * @param f2 Second pivot's fraction
+ */
+void
+quicksort_warm_store(quicksort_data_t* data, const state_t* state, blk_t blk, float f1, float f2);
+
+/** @brief Cost of a pair of pivot indices, see @ref quicksort_cache_t */
+typedef struct
+{
+	/** @brief Pivot indices packed by @ref quicksort_cache_get, `0` for empty entries */
+	uint64_t key;
+	/** @brief Cost of the pivots, `SIZE_MAX` until evaluated */
+	size_t cost;
+	/** @brief Layout the cost was reached with */
+	size_t layout;
+	/** @brief Lower bound of the cost while unknown, left by evaluations that skipped
+	 * layouts against an external bound, `0` when the pivots were never evaluated */
+	size_t lower;
+} quicksort_cache_entry_t;
+
+/**
+ * @brief Costs of the pivots evaluated while choosing a block's pivots
+ *
+ * An open-addressing hash table allocated from the calling thread's arena, so that
+ * its setup scales with the number of evaluations rather than with the square of the
+ * block's size. Entries are claimed with a compare-and-swap, so threads may look up
+ * and insert pivots concurrently as long as the table does not grow meanwhile, see
+ * @ref quicksort_cache_reserve.
+ */
+typedef struct
+{
+	quicksort_cache_entry_t* entries;
+	/** @brief Number of entries, a power of two */
+	size_t capacity;
+	/** @brief Number of entries in use */
+	size_t size;
+} quicksort_cache_t;
+
+/** @brief Create an empty cache with room for @p count pivots */
+quicksort_cache_t
+quicksort_cache_new(size_t count);
+/**
+ * @brief Grow @p cache so that @p count more pivots can be inserted without growing
+ *
+ * Must be called by the thread owning @p cache, with no other thread using it.
+ */
+void
+quicksort_cache_reserve(quicksort_cache_t* cache, size_t count);
+/**
+ * @brief Find or insert the entry of pivots @p i1 and @p i2
+ *
+ * Inserting grows the table when it is half full, which invalidates previously returned
+ * entries and is only valid on the thread owning @p cache.
+ *
+ * @return The entry of the pivots, with a `SIZE_MAX` cost if they were never evaluated
+ */
+quicksort_cache_entry_t*
+quicksort_cache_get(quicksort_cache_t* cache, size_t i1, size_t i2);
+
 /** @brief Free the quicksort data */
 void
 quicksort_data_free(quicksort_data_t* data);
@@ -0,0 +1,2094 @@
+/* Generated by tools/blk_sort_gen.c, do not edit */
+#ifndef SORT_TABLES_H
+#define SORT_TABLES_H
+
+#include <stdint.h>
+
+/** @brief Longest sequence in @ref blk_sort_ops */
+#define BLK_SORT_LONGEST 16
+
+/** @brief `STACK_OP_NOP` terminated operation sequences */
+static const uint8_t blk_sort_ops[43144] = {
+	20, 5, 20, 17, 17, 5, 20, 17, 17, 20, 6, 9, 9, 20, 9, 9, 20, 18, 18, 9, 9, 20, 18, 9,
+	18, 9, 20, 20, 10, 5, 9, 20, 5, 20, 10, 5, 9, 5, 20, 5, 10, 5, 9, 20, 5, 10, 5, 9,
+	5, 20, 17, 10, 17, 17, 5, 9, 20, 17, 10, 17, 17, 9, 20, 17, 17, 10, 17, 5, 9, 20, 17, 17,
+	5, 17, 20, 17, 17, 17, 5, 20, 17, 17, 17, 20, 6, 9, 6, 9, 5, 9, 20, 6, 9, 6, 9, 9,
+	20, 9, 6, 9, 5, 9, 20, 6, 9, 9, 9, 20, 9, 6, 9, 9, 20, 9, 9, 9, 20, 18, 18, 18,
+	9, 9, 9, 20, 18, 18, 9, 18, 9, 9, 20, 18, 9, 18, 18, 9, 5, 9, 20, 18, 18, 9, 9, 18,
+	9, 20, 18, 9, 18, 18, 9, 9, 20, 18, 9, 18, 9, 18, 9, 20, 20, 10, 10, 5, 9, 9, 20, 10,
+	5, 9, 20, 10, 10, 5, 9, 5, 9, 20, 10, 5, 10, 5, 9, 9, 20, 10, 5, 10, 5, 9, 5, 9,
+	20, 5, 20, 10, 10, 7, 9, 9, 20, 10, 5, 9, 5, 20, 10, 10, 5, 9, 5, 9, 5, 20, 10, 5,
+	10, 7, 9, 9, 20, 10, 5, 10, 5, 9, 5, 9, 5, 20, 5, 10, 5, 9, 20, 10, 10, 7, 9, 5,
+	9, 20, 5, 10, 5, 9, 5, 20, 10, 10, 7, 9, 5, 9, 5, 20, 10, 5, 10, 7, 9, 5, 9, 20,
+	10, 5, 10, 7, 9, 5, 9, 5, 20, 5, 10, 5, 10, 5, 9, 9, 20, 5, 10, 5, 10, 5, 9, 5,
+	9, 20, 5, 10, 5, 10, 7, 9, 9, 20, 10, 10, 7, 13, 9, 5, 9, 17, 20, 5, 10, 5, 10, 7,
+	9, 5, 9, 20, 5, 10, 5, 10, 7, 9, 5, 9, 5, 20, 17, 10, 17, 10, 17, 17, 5, 9, 9, 20,
+	17, 10, 17, 10, 17, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 9, 9, 20, 17, 10, 17, 17, 5,
+	17, 9, 20, 17, 10, 17, 17, 17, 5, 9, 20, 17, 10, 17, 17, 17, 9, 20, 17, 10, 17, 10, 17, 17,
+	7, 9, 9, 20, 17, 17, 10, 10, 17, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 7, 9, 9, 20, 17,
+	10, 17, 17, 5, 9, 17, 20, 17, 10, 17, 17, 17, 5, 9, 5, 20, 17, 10, 17, 17, 9, 17, 20, 17,
+	17, 10, 17, 10, 17, 5, 9, 9, 20, 17, 17, 10, 17, 5, 17, 9, 20, 17, 17, 10, 17, 10, 17, 7,
+	9, 9, 20, 17, 17, 10, 17, 5, 9, 17, 20, 17, 17, 5, 17, 17, 5, 20, 17, 17, 5, 17, 17, 20,
+	17, 17, 10, 17, 17, 5, 9, 20, 17, 17, 10, 17, 17, 9, 20, 17, 17, 17, 10, 17, 5, 9, 20, 17,
+	17, 17, 5, 17, 20, 17, 17, 17, 17, 5, 20, 17, 17, 17, 17, 20, 6, 9, 15, 6, 9, 9, 19, 9,
+	20, 6, 9, 15, 9, 9, 19, 9, 20, 9, 9, 7, 13, 9, 5, 9, 17, 20, 6, 9, 6, 9, 7, 9,
+	9, 20, 9, 9, 7, 9, 5, 9, 5, 20, 9, 13, 9, 9, 9, 17, 20, 9, 15, 6, 9, 9, 19, 9,
+	20, 9, 15, 9, 9, 19, 9, 20, 6, 9, 9, 15, 9, 5, 19, 9, 20, 6, 9, 6, 9, 5, 9, 9,
+	20, 9, 9, 7, 9, 5, 9, 20, 6, 9, 6, 9, 9, 9, 20, 9, 6, 9, 15, 9, 5, 19, 9, 20,
+	9, 6, 9, 7, 9, 9, 20, 9, 9, 15, 9, 5, 19, 9, 20, 9, 6, 9, 5, 9, 9, 20, 9, 9,
+	7, 9, 9, 20, 6, 9, 9, 9, 9, 20, 9, 6, 9, 6, 9, 5, 9, 20, 9, 6, 9, 6, 9, 9,
+	20, 9, 9, 6, 9, 5, 9, 20, 9, 6, 9, 9, 9, 20, 9, 9, 6, 9, 9, 20, 9, 9, 9, 9,
+	20, 18, 18, 18, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18,
+	9, 5, 9, 9, 20, 18, 18, 18, 9, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 9, 9, 9, 20, 18,
+	18, 9, 18, 9, 18, 9, 9, 20, 18, 18, 6, 18, 18, 9, 9, 9, 9, 20, 18, 18, 6, 18, 9, 18,
+	9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 9, 20, 18, 18, 18, 9, 9, 9, 18, 9, 20, 18,
+	18, 9, 9, 18, 18, 9, 5, 9, 20, 18, 18, 9, 18, 9, 9, 18, 9, 20, 18, 9, 18, 18, 18, 9,
+	5, 9, 9, 20, 18, 9, 13, 18, 18, 9, 19, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9, 9, 20,
+	18, 9, 18, 18, 9, 5, 9, 18, 9, 20, 18, 18, 9, 9, 18, 18, 9, 9, 20, 18, 18, 9, 9, 18,
+	9, 18, 9, 20, 18, 9, 18, 18, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 9, 9, 20, 18, 9,
+	18, 9, 18, 18, 9, 5, 9, 20, 18, 9, 18, 18, 9, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 9,
+	9, 20, 18, 9, 18, 9, 18, 9, 18, 9, 20, 20, 10, 10, 10, 5, 9, 9, 9, 20, 10, 10, 5, 9,
+	9, 20, 10, 10, 10, 5, 9, 5, 9, 9, 20, 10, 10, 5, 10, 5, 9, 9, 9, 20, 10, 10, 5, 10,
+	5, 9, 5, 9, 9, 20, 10, 5, 9, 20, 10, 10, 10, 7, 9, 9, 9, 20, 10, 10, 5, 9, 5, 9,
+	20, 10, 10, 10, 5, 9, 5, 9, 5, 9, 20, 10, 10, 5, 10, 7, 9, 9, 9, 20, 10, 10, 5, 10,
+	5, 9, 5, 9, 5, 9, 20, 10, 5, 10, 5, 9, 9, 20, 10, 10, 10, 7, 9, 5, 9, 9, 20, 10,
+	5, 10, 5, 9, 5, 9, 20, 10, 10, 10, 7, 9, 5, 9, 5, 9, 20, 10, 10, 5, 10, 7, 9, 5,
+	9, 9, 20, 10, 10, 5, 10, 7, 9, 5, 9, 5, 9, 20, 10, 5, 10, 5, 10, 5, 9, 9, 9, 20,
+	10, 5, 10, 5, 10, 5, 9, 5, 9, 9, 20, 10, 5, 10, 5, 10, 7, 9, 9, 9, 20, 10, 10, 10,
+	7, 13, 9, 5, 9, 17, 9, 20, 10, 5, 10, 5, 10, 7, 9, 5, 9, 9, 20, 10, 5, 10, 5, 10,
+	7, 9, 5, 9, 5, 9, 20, 5, 20, 10, 10, 13, 7, 17, 9, 9, 20, 10, 10, 7, 9, 9, 20, 10,
+	10, 10, 5, 9, 7, 9, 9, 20, 10, 10, 5, 13, 7, 17, 9, 9, 20, 10, 10, 5, 10, 5, 9, 7,
+	9, 9, 20, 10, 5, 9, 5, 20, 10, 10, 13, 5, 9, 9, 17, 20, 10, 10, 5, 9, 5, 9, 5, 20,
+	10, 10, 10, 5, 13, 9, 9, 9, 17, 20, 10, 10, 5, 13, 5, 9, 9, 17, 20, 10, 10, 5, 10, 5,
+	13, 9, 9, 9, 17, 20, 10, 5, 10, 7, 9, 9, 20, 10, 10, 10, 7, 9, 7, 9, 9, 20, 10, 5,
+	10, 5, 9, 5, 9, 5, 20, 10, 10, 10, 7, 13, 9, 9, 9, 17, 20, 10, 10, 5, 10, 7, 9, 7,
+	9, 9, 20, 10, 10, 5, 10, 7, 13, 9, 9, 9, 17, 20, 10, 5, 10, 5, 13, 7, 17, 9, 9, 20,
+	10, 5, 10, 5, 10, 5, 9, 7, 9, 9, 20, 10, 5, 10, 5, 13, 5, 9, 9, 17, 20, 10, 10, 10,
+	7, 13, 9, 5, 9, 9, 17, 20, 10, 5, 10, 5, 10, 7, 9, 7, 9, 9, 20, 10, 5, 10, 5, 10,
+	7, 13, 9, 9, 9, 17, 20, 5, 10, 5, 9, 20, 10, 10, 13, 7, 9, 17, 9, 20, 10, 10, 7, 9,
+	5, 9, 20, 10, 10, 10, 5, 9, 7, 9, 5, 9, 20, 10, 10, 5, 13, 7, 9, 17, 9, 20, 10, 10,
+	5, 10, 5, 9, 7, 9, 5, 9, 20, 5, 10, 5, 9, 5, 20, 10, 10, 13, 7, 9, 9, 17, 20, 10,
+	10, 7, 9, 5, 9, 5, 20, 10, 13, 15, 5, 10, 19, 9, 17, 9, 20, 10, 10, 5, 13, 7, 9, 9,
+	17, 20, 10, 10, 7, 10, 5, 13, 9, 9, 9, 17, 20, 10, 5, 10, 7, 9, 5, 9, 20, 10, 10, 10,
+	5, 15, 9, 9, 19, 9, 20, 10, 5, 10, 7, 9, 5, 9, 5, 20, 10, 5, 13, 15, 5, 10, 19, 9,
+	17, 9, 20, 10, 10, 5, 10, 5, 15, 9, 9, 19, 9, 20, 10, 10, 5, 10, 5, 15, 9, 9, 18, 9,
+	17, 20, 10, 5, 10, 5, 13, 7, 9, 17, 9, 20, 10, 10, 10, 5, 15, 9, 5, 9, 19, 9, 20, 10,
+	5, 10, 5, 13, 7, 9, 9, 17, 20, 10, 10, 10, 7, 13, 9, 7, 9, 9, 17, 20, 10, 5, 10, 5,
+	10, 5, 15, 9, 9, 19, 9, 20, 10, 10, 5, 10, 7, 13, 9, 7, 9, 9, 17, 20, 5, 10, 5, 10,
+	5, 9, 9, 20, 10, 10, 13, 7, 9, 5, 17, 9, 20, 5, 10, 5, 10, 5, 9, 5, 9, 20, 10, 10,
+	13, 7, 9, 5, 17, 5, 9, 20, 10, 10, 5, 13, 7, 9, 5, 17, 9, 20, 10, 10, 5, 13, 7, 9,
+	5, 17, 5, 9, 20, 5, 10, 5, 10, 7, 9, 9, 20, 10, 10, 13, 7, 9, 5, 9, 17, 20, 10, 10,
+	7, 13, 9, 5, 9, 17, 20, 5, 10, 10, 10, 7, 13, 9, 9, 9, 17, 20, 10, 10, 5, 13, 7, 9,
+	5, 9, 17, 20, 10, 10, 7, 10, 7, 13, 9, 9, 9, 17, 20, 5, 10, 5, 10, 7, 9, 5, 9, 20,
+	10, 10, 13, 7, 9, 5, 9, 5, 17, 20, 5, 10, 5, 10, 7, 9, 5, 9, 5, 20, 10, 10, 13, 7,
+	9, 5, 9, 5, 17, 5, 20, 10, 10, 5, 13, 7, 9, 5, 9, 5, 17, 20, 10, 10, 5, 13, 7, 9,
+	5, 9, 5, 17, 5, 20, 10, 5, 10, 5, 13, 7, 9, 5, 17, 9, 20, 10, 5, 10, 5, 13, 7, 9,
+	5, 17, 5, 9, 20, 10, 5, 10, 5, 13, 7, 9, 5, 9, 17, 20, 10, 5, 10, 7, 10, 7, 13, 9,
+	9, 9, 17, 20, 10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17, 20, 10, 5, 10, 5, 13, 7, 9, 5,
+	9, 5, 17, 5, 20, 10, 10, 13, 15, 9, 5, 17, 19, 9, 20, 10, 10, 13, 5, 15, 9, 5, 17, 19,
+	9, 20, 13, 10, 10, 10, 17, 7, 9, 9, 9, 20, 10, 13, 10, 7, 13, 9, 5, 9, 17, 17, 20, 13,
+	10, 10, 10, 17, 7, 9, 5, 9, 9, 20, 10, 10, 7, 10, 7, 13, 9, 5, 9, 17, 9, 20, 10, 10,
+	13, 15, 9, 5, 19, 9, 17, 20, 10, 10, 13, 5, 15, 9, 5, 19, 9, 17, 20, 5, 10, 5, 10, 5,
+	13, 5, 9, 9, 17, 20, 5, 10, 10, 10, 7, 13, 9, 5, 9, 9, 17, 20, 13, 10, 10, 10, 17, 7,
+	9, 7, 9, 9, 20, 10, 10, 7, 10, 7, 13, 9, 5, 9, 9, 17, 20, 5, 10, 5, 10, 5, 13, 7,
+	9, 17, 9, 20, 10, 10, 13, 7, 13, 9, 5, 9, 17, 17, 20, 5, 10, 5, 10, 5, 13, 7, 9, 9,
+	17, 20, 5, 10, 10, 10, 7, 13, 9, 7, 9, 9, 17, 20, 10, 10, 5, 13, 7, 13, 9, 5, 9, 17,
+	17, 20, 10, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 20, 5, 10, 5, 10, 5, 13, 7, 9, 5, 17,
+	9, 20, 10, 10, 13, 7, 10, 15, 9, 9, 19, 9, 17, 20, 5, 10, 5, 10, 5, 13, 7, 9, 5, 9,
+	17, 20, 10, 10, 13, 7, 10, 15, 9, 9, 17, 19, 9, 20, 5, 10, 5, 10, 5, 13, 7, 9, 5, 9,
+	5, 17, 20, 10, 5, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 20, 17, 10, 17, 10, 17, 10, 17, 17,
+	5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10,
+	17, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17,
+	5, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 7, 9,
+	9, 9, 20, 17, 10, 17, 17, 10, 10, 17, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 7,
+	9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 9, 17, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5, 9,
+	5, 9, 20, 17, 10, 17, 10, 17, 17, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 5, 9, 9,
+	9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 7, 9, 9,
+	9, 20, 17, 10, 17, 17, 10, 17, 5, 9, 17, 9, 20, 17, 10, 17, 17, 5, 17, 17, 5, 9, 20, 17,
+	10, 17, 17, 5, 17, 17, 9, 20, 17, 10, 17, 17, 10, 17, 17, 5, 9, 9, 20, 17, 10, 17, 17, 10,
+	17, 17, 9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 5, 9, 9, 20, 17, 10, 17, 17, 17, 5, 17, 9,
+	20, 17, 10, 17, 17, 17, 17, 5, 9, 20, 17, 10, 17, 17, 17, 17, 9, 20, 17, 17, 10, 10, 17, 10,
+	17, 17, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 7, 9, 9, 20, 17, 17, 10, 10, 17,
+	17, 10, 17, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 7, 17, 9, 9, 20, 17, 10, 17, 10, 17,
+	17, 17, 7, 9, 9, 20, 17, 17, 10, 10, 17, 17, 17, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17,
+	7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10,
+	17, 7, 9, 6, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 9, 9, 17, 20, 17, 10, 17, 17, 5, 17,
+	10, 17, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 9, 9, 17, 20, 17, 10, 14, 17, 17, 10, 17, 10,
+	19, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 7, 17, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10,
+	10, 19, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 9, 9, 17, 20, 17, 10, 17, 17, 5, 17,
+	17, 5, 9, 5, 20, 17, 10, 17, 17, 5, 17, 9, 17, 20, 17, 10, 17, 17, 10, 17, 17, 7, 9, 9,
+	20, 17, 10, 14, 17, 17, 10, 17, 19, 9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 7, 9, 9, 20, 17,
+	10, 17, 17, 17, 5, 9, 17, 20, 17, 10, 17, 17, 17, 17, 5, 9, 5, 20, 17, 10, 17, 17, 17, 9,
+	17, 20, 17, 17, 10, 10, 17, 10, 17, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 10, 17, 17, 9,
+	9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 7, 9,
+	17, 9, 20, 17, 10, 17, 10, 17, 17, 17, 7, 9, 5, 9, 20, 17, 17, 10, 10, 17, 17, 9, 17, 9,
+	20, 17, 17, 17, 10, 10, 10, 17, 17, 5, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 7, 9,
+	9, 20, 17, 10, 17, 10, 17, 17, 17, 5, 13, 7, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 7, 9,
+	9, 17, 20, 17, 17, 10, 17, 5, 17, 10, 17, 7, 9, 9, 20, 17, 17, 10, 10, 17, 17, 9, 9, 17,
+	20, 17, 10, 14, 17, 17, 10, 17, 10, 19, 5, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 7, 9, 17,
+	9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 19, 5, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 7, 9,
+	9, 17, 20, 17, 10, 17, 17, 5, 9, 17, 17, 5, 20, 17, 10, 17, 17, 5, 9, 17, 17, 20, 17, 10,
+	17, 17, 10, 17, 17, 7, 9, 5, 9, 20, 17, 17, 5, 17, 10, 17, 5, 17, 9, 20, 17, 10, 17, 17,
+	17, 10, 17, 7, 9, 5, 9, 20, 17, 10, 17, 17, 17, 5, 9, 5, 17, 20, 17, 10, 17, 17, 9, 17,
+	17, 5, 20, 17, 10, 17, 17, 9, 17, 17, 20, 17, 17, 10, 17, 10, 17, 10, 17, 5, 9, 9, 9, 20,
+	17, 17, 10, 17, 10, 17, 5, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 7, 9, 9, 9, 20,
+	17, 17, 10, 17, 10, 17, 5, 9, 17, 9, 20, 17, 17, 10, 17, 5, 17, 17, 5, 9, 20, 17, 17, 10,
+	17, 5, 17, 17, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 5, 9, 9, 9, 20, 17, 17, 10, 17, 10,
+	17, 7, 17, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10,
+	17, 5, 9, 9, 17, 20, 17, 17, 10, 17, 5, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 5, 17, 9,
+	17, 20, 17, 17, 17, 10, 10, 17, 10, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 7, 9, 17,
+	9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 5, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 7, 9, 9,
+	17, 20, 17, 17, 10, 17, 5, 9, 17, 17, 5, 20, 17, 17, 10, 17, 5, 9, 17, 17, 20, 17, 17, 5,
+	17, 10, 17, 17, 5, 9, 20, 17, 17, 5, 17, 10, 17, 17, 9, 20, 17, 17, 5, 17, 17, 10, 17, 5,
+	9, 20, 17, 17, 5, 17, 17, 5, 17, 20, 17, 17, 5, 17, 17, 17, 5, 20, 17, 17, 5, 17, 17, 17,
+	20, 17, 17, 10, 17, 10, 17, 17, 5, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 9, 9, 20, 17, 17,
+	10, 17, 17, 10, 17, 5, 9, 9, 20, 17, 17, 10, 17, 17, 5, 17, 9, 20, 17, 17, 10, 17, 17, 17,
+	5, 9, 20, 17, 17, 10, 17, 17, 17, 9, 20, 17, 17, 10, 17, 10, 17, 17, 7, 9, 9, 20, 17, 17,
+	17, 10, 10, 17, 17, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 7, 9, 9, 20, 17, 17, 10, 17, 17,
+	5, 9, 17, 20, 17, 17, 10, 17, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 17, 9, 17, 20, 17, 17,
+	17, 10, 17, 10, 17, 5, 9, 9, 20, 17, 17, 17, 10, 17, 5, 17, 9, 20, 17, 17, 17, 10, 17, 10,
+	17, 7, 9, 9, 20, 17, 17, 17, 10, 17, 5, 9, 17, 20, 17, 17, 17, 5, 17, 17, 5, 20, 17, 17,
+	17, 5, 17, 17, 20, 17, 17, 17, 10, 17, 17, 5, 9, 20, 17, 17, 17, 10, 17, 17, 9, 20, 17, 17,
+	17, 17, 10, 17, 5, 9, 20, 17, 17, 17, 17, 5, 17, 20, 17, 17, 17, 17, 17, 5, 20, 17, 17, 17,
+	17, 17, 20, 9, 15, 9, 6, 13, 9, 9, 19, 9, 17, 20, 9, 15, 9, 13, 9, 9, 19, 9, 17, 20,
+	6, 9, 15, 9, 6, 9, 5, 9, 19, 9, 20, 6, 9, 15, 6, 9, 9, 9, 19, 9, 20, 6, 9, 15,
+	9, 6, 9, 9, 19, 9, 20, 6, 9, 15, 9, 9, 9, 19, 9, 20, 9, 13, 9, 15, 6, 9, 9, 19,
+	9, 17, 20, 9, 13, 9, 15, 9, 9, 19, 9, 17, 20, 9, 15, 9, 6, 9, 5, 18, 9, 9, 17, 20,
+	9, 15, 6, 9, 9, 18, 9, 9, 17, 20, 9, 13, 9, 9, 7, 9, 5, 9, 17, 20, 9, 15, 9, 9,
+	18, 9, 9, 17, 20, 14, 9, 9, 6, 13, 9, 5, 9, 19, 9, 20, 9, 9, 7, 13, 9, 7, 9, 9,
+	17, 20, 9, 13, 9, 9, 15, 9, 5, 19, 9, 17, 20, 9, 9, 7, 13, 9, 5, 9, 9, 17, 20, 9,
+	13, 9, 9, 7, 9, 9, 17, 20, 9, 6, 13, 9, 9, 9, 9, 17, 20, 14, 9, 9, 6, 13, 9, 9,
+	19, 9, 20, 14, 9, 9, 13, 9, 9, 19, 9, 20, 9, 13, 9, 9, 6, 9, 5, 9, 17, 20, 9, 9,
+	7, 13, 9, 9, 9, 17, 20, 9, 13, 9, 9, 6, 9, 9, 17, 20, 9, 13, 9, 9, 9, 9, 17, 20,
+	9, 14, 15, 6, 9, 9, 18, 9, 19, 9, 20, 9, 14, 15, 9, 9, 18, 9, 19, 9, 20, 9, 15, 9,
+	6, 9, 5, 9, 19, 9, 20, 9, 15, 6, 9, 9, 9, 19, 9, 20, 9, 15, 9, 6, 9, 9, 19, 9,
+	20, 9, 15, 9, 9, 9, 19, 9, 20, 9, 13, 9, 15, 6, 9, 9, 17, 19, 9, 20, 9, 13, 9, 15,
+	9, 9, 17, 19, 9, 20, 6, 9, 15, 9, 6, 9, 5, 19, 9, 9, 20, 6, 9, 15, 6, 9, 9, 19,
+	9, 9, 20, 6, 9, 15, 9, 6, 9, 19, 9, 9, 20, 6, 9, 15, 9, 9, 19, 9, 9, 20, 6, 9,
+	9, 15, 6, 9, 5, 9, 19, 9, 20, 6, 9, 9, 15, 9, 5, 9, 19, 9, 20, 9, 9, 7, 15, 6,
+	9, 5, 9, 19, 9, 20, 9, 9, 7, 13, 9, 5, 9, 17, 9, 20, 9, 13, 9, 9, 7, 9, 17, 9,
+	20, 6, 9, 6, 9, 7, 9, 9, 9, 20, 6, 9, 9, 15, 6, 9, 9, 19, 9, 20, 6, 9, 9, 15,
+	9, 9, 19, 9, 20, 9, 9, 7, 15, 6, 9, 9, 19, 9, 20, 9, 9, 7, 9, 5, 9, 5, 9, 20,
+	6, 9, 9, 9, 7, 9, 5, 9, 20, 9, 13, 9, 9, 9, 17, 9, 20, 9, 9, 13, 15, 6, 9, 9,
+	19, 9, 17, 20, 9, 9, 13, 15, 9, 9, 19, 9, 17, 20, 9, 15, 9, 6, 9, 5, 9, 19, 5, 9,
+	20, 9, 15, 6, 9, 9, 9, 19, 5, 9, 20, 9, 9, 13, 9, 7, 9, 5, 9, 17, 20, 9, 6, 9,
+	7, 9, 7, 9, 9, 20, 9, 9, 13, 15, 6, 9, 9, 17, 19, 9, 20, 9, 9, 13, 15, 9, 9, 17,
+	19, 9, 20, 9, 15, 9, 6, 9, 5, 19, 9, 9, 20, 9, 15, 6, 9, 9, 19, 9, 9, 20, 9, 15,
+	9, 6, 9, 19, 9, 9, 20, 9, 15, 9, 9, 19, 9, 9, 20, 9, 9, 7, 15, 6, 9, 5, 19, 9,
+	9, 20, 9, 9, 7, 13, 9, 7, 17, 9, 9, 20, 6, 9, 9, 15, 6, 9, 5, 19, 9, 9, 20, 6,
+	9, 9, 15, 9, 5, 19, 9, 9, 20, 9, 6, 9, 5, 9, 7, 9, 9, 20, 6, 9, 6, 9, 5, 9,
+	9, 9, 20, 9, 9, 7, 9, 15, 9, 5, 19, 9, 20, 9, 9, 7, 9, 7, 9, 9, 20, 6, 9, 9,
+	9, 15, 9, 5, 19, 9, 20, 9, 9, 7, 9, 5, 9, 9, 20, 6, 9, 9, 9, 7, 9, 9, 20, 6,
+	9, 6, 9, 9, 9, 9, 20, 9, 6, 9, 15, 6, 9, 5, 9, 19, 9, 20, 9, 6, 9, 15, 9, 5,
+	9, 19, 9, 20, 9, 9, 13, 9, 15, 9, 5, 19, 9, 17, 20, 9, 9, 6, 13, 9, 5, 9, 9, 17,
+	20, 9, 9, 13, 9, 7, 9, 9, 17, 20, 9, 6, 9, 7, 9, 6, 9, 9, 20, 9, 9, 15, 6, 9,
+	5, 9, 19, 9, 20, 9, 9, 15, 9, 5, 9, 19, 9, 20, 9, 6, 9, 15, 6, 9, 5, 19, 9, 9,
+	20, 9, 6, 9, 15, 9, 5, 19, 9, 9, 20, 9, 9, 13, 9, 7, 9, 17, 9, 20, 9, 6, 9, 7,
+	9, 9, 9, 20, 9, 9, 6, 15, 6, 9, 5, 19, 9, 9, 20, 9, 9, 6, 13, 9, 7, 17, 9, 9,
+	20, 9, 9, 15, 6, 9, 5, 19, 9, 9, 20, 9, 9, 15, 9, 5, 19, 9, 9, 20, 9, 6, 9, 5,
+	9, 6, 9, 9, 20, 9, 6, 9, 5, 9, 9, 9, 20, 9, 9, 7, 9, 6, 9, 5, 9, 20, 9, 9,
+	7, 9, 6, 9, 9, 20, 6, 9, 9, 9, 6, 9, 5, 9, 20, 9, 9, 7, 9, 9, 9, 20, 6, 9,
+	9, 9, 6, 9, 9, 20, 6, 9, 9, 9, 9, 9, 20, 9, 6, 9, 15, 6, 9, 9, 19, 9, 20, 9,
+	6, 9, 15, 9, 9, 19, 9, 20, 9, 9, 9, 7, 13, 9, 5, 9, 17, 20, 9, 6, 9, 6, 9, 7,
+	9, 9, 20, 9, 9, 9, 7, 9, 5, 9, 5, 20, 9, 9, 13, 9, 9, 9, 17, 20, 9, 9, 15, 6,
+	9, 9, 19, 9, 20, 9, 9, 15, 9, 9, 19, 9, 20, 9, 6, 9, 9, 15, 9, 5, 19, 9, 20, 9,
+	6, 9, 6, 9, 5, 9, 9, 20, 9, 9, 9, 7, 9, 5, 9, 20, 9, 6, 9, 6, 9, 9, 9, 20,
+	9, 9, 6, 9, 15, 9, 5, 19, 9, 20, 9, 9, 6, 9, 7, 9, 9, 20, 9, 9, 9, 15, 9, 5,
+	19, 9, 20, 9, 9, 6, 9, 5, 9, 9, 20, 9, 9, 9, 7, 9, 9, 20, 9, 6, 9, 9, 9, 9,
+	20, 9, 9, 6, 9, 6, 9, 5, 9, 20, 9, 9, 6, 9, 6, 9, 9, 20, 9, 9, 9, 6, 9, 5,
+	9, 20, 9, 9, 6, 9, 9, 9, 20, 9, 9, 9, 6, 9, 9, 20, 9, 9, 9, 9, 9, 20, 18, 18,
+	18, 18, 18, 9, 9, 9, 9, 9, 20, 18, 18, 18, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9,
+	18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 18, 18, 9, 9, 18, 9, 9, 9, 20, 18, 18, 18, 9, 18,
+	18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 9, 18, 9, 9, 9, 20, 18, 18, 18, 6, 18, 18, 9,
+	9, 9, 9, 9, 20, 18, 18, 18, 6, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9,
+	7, 9, 9, 9, 20, 18, 18, 18, 18, 9, 9, 9, 18, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9,
+	5, 9, 9, 20, 18, 18, 18, 9, 18, 9, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 5, 9,
+	9, 9, 20, 18, 18, 9, 13, 18, 18, 9, 19, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 7, 9,
+	9, 9, 20, 18, 18, 9, 18, 18, 9, 5, 9, 18, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9, 9,
+	9, 20, 18, 18, 18, 9, 9, 18, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 9, 9, 9, 20,
+	18, 18, 9, 18, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 5, 9, 9, 20, 18,
+	18, 9, 18, 18, 9, 9, 18, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 9, 9, 20, 18, 18, 9,
+	18, 9, 18, 9, 18, 9, 9, 20, 18, 18, 6, 18, 18, 18, 9, 9, 9, 9, 9, 20, 18, 18, 6, 18,
+	18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 9, 9, 9, 7, 9, 9, 20, 18, 18, 6, 18,
+	18, 9, 9, 18, 9, 9, 9, 20, 18, 18, 6, 18, 9, 18, 18, 9, 9, 9, 9, 20, 18, 18, 6, 18,
+	9, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 5, 9, 7, 9, 9, 20, 18, 18, 9,
+	13, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 7, 9, 7, 9, 9, 20, 18,
+	18, 18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9, 7, 9, 9, 20, 18, 18,
+	18, 9, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18,
+	9, 18, 18, 9, 7, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18,
+	18, 9, 18, 18, 9, 5, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 7, 18, 9, 9, 9, 20, 18,
+	18, 18, 9, 9, 18, 9, 9, 18, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 9, 9, 9, 20, 18, 18,
+	9, 18, 6, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 7, 9, 9, 20, 18, 18,
+	9, 18, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 9, 18, 18, 9, 5, 9, 20, 18, 18, 9,
+	18, 9, 18, 9, 9, 18, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 9, 17, 9, 9, 20, 18, 9, 13,
+	18, 18, 18, 9, 18, 9, 17, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 9, 5, 9, 9, 20, 18,
+	9, 13, 18, 18, 18, 9, 9, 19, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 9, 17, 9, 9, 20,
+	18, 9, 13, 18, 18, 9, 18, 9, 19, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 5, 9, 7, 9, 9,
+	20, 18, 9, 13, 18, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 9, 7,
+	9, 9, 20, 18, 18, 6, 18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 9, 13, 18, 18, 9, 18, 19, 9,
+	7, 9, 9, 20, 18, 18, 6, 18, 9, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9,
+	7, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 18, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18,
+	18, 9, 7, 17, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 18, 18, 9, 9,
+	9, 18, 18, 9, 9, 20, 18, 18, 18, 9, 9, 9, 18, 9, 18, 9, 20, 18, 18, 9, 9, 18, 18, 18,
+	9, 5, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 9, 19, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18,
+	9, 7, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9, 5, 9, 18, 9, 20, 18, 18, 9, 18, 9, 9, 18,
+	18, 9, 9, 20, 18, 18, 9, 18, 9, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18, 18, 18, 9, 5, 9,
+	9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 19, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 9,
+	9, 9, 20, 18, 9, 18, 18, 18, 9, 5, 9, 18, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 19, 9,
+	9, 9, 20, 18, 9, 13, 18, 18, 9, 19, 9, 18, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 9, 5,
+	9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 18, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7,
+	9, 6, 9, 9, 20, 18, 9, 18, 18, 18, 9, 5, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 7,
+	18, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 19, 9, 9, 18, 9, 20, 18, 9, 18, 18, 6, 18, 18,
+	9, 7, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9, 18, 9, 9, 20, 18, 9, 18, 9, 13, 18,
+	18, 18, 9, 7, 17, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 9, 18, 18,
+	9, 5, 9, 18, 18, 9, 9, 20, 18, 9, 18, 18, 9, 5, 9, 18, 9, 18, 9, 20, 18, 18, 9, 9,
+	18, 18, 18, 9, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18,
+	7, 18, 9, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9, 9, 18, 9, 20, 18, 18, 9, 9, 18, 9, 18,
+	18, 9, 9, 20, 18, 18, 9, 9, 18, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18, 18, 18, 9, 9, 9,
+	9, 20, 18, 9, 18, 18, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 5, 9, 9,
+	20, 18, 9, 18, 18, 18, 9, 9, 18, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 9, 9, 20, 18,
+	9, 18, 18, 9, 18, 9, 18, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 9, 9, 9, 9, 20, 18, 9,
+	18, 18, 6, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 7, 9, 9, 20, 18, 9,
+	18, 18, 18, 9, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 9, 18, 18, 9, 5, 9, 20, 18, 9, 18,
+	18, 9, 18, 9, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 5, 9, 9, 20, 18, 9, 18, 9,
+	13, 18, 18, 9, 19, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 9,
+	18, 18, 9, 5, 9, 18, 9, 20, 18, 9, 18, 18, 9, 9, 18, 18, 9, 9, 20, 18, 9, 18, 18, 9,
+	9, 18, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 9, 9, 20, 18, 9, 18, 9, 18, 18, 9,
+	18, 9, 9, 20, 18, 9, 18, 9, 18, 9, 18, 18, 9, 5, 9, 20, 18, 9, 18, 9, 18, 18, 9, 9,
+	18, 9, 20, 18, 9, 18, 9, 18, 9, 18, 18, 9, 9, 20, 18, 9, 18, 9, 18, 9, 18, 9, 18, 9,
+	20, 20, 10, 10, 10, 10, 5, 9, 9, 9, 9, 20, 10, 10, 10, 5, 9, 9, 9, 20, 10, 10, 10, 10,
+	5, 9, 5, 9, 9, 9, 20, 10, 10, 10, 5, 10, 5, 9, 9, 9, 9, 20, 10, 10, 10, 5, 10, 5,
+	9, 5, 9, 9, 9, 20, 10, 10, 5, 9, 9, 20, 10, 10, 10, 10, 7, 9, 9, 9, 9, 20, 10, 10,
+	10, 5, 9, 5, 9, 9, 20, 10, 10, 10, 10, 5, 9, 5, 9, 5, 9, 9, 20, 10, 10, 10, 5, 10,
+	7, 9, 9, 9, 9, 20, 10, 10, 10, 5, 10, 5, 9, 5, 9, 5, 9, 9, 20, 10, 10, 5, 10, 5,
+	9, 9, 9, 20, 10, 10, 10, 10, 7, 9, 5, 9, 9, 9, 20, 10, 10, 5, 10, 5, 9, 5, 9, 9,
+	20, 10, 10, 10, 10, 7, 9, 5, 9, 5, 9, 9, 20, 10, 10, 10, 5, 10, 7, 9, 5, 9, 9, 9,
+	20, 10, 10, 10, 5, 10, 7, 9, 5, 9, 5, 9, 9, 20, 10, 10, 5, 10, 5, 10, 5, 9, 9, 9,
+	9, 20, 10, 10, 5, 10, 5, 10, 5, 9, 5, 9, 9, 9, 20, 10, 10, 5, 10, 5, 10, 7, 9, 9,
+	9, 9, 20, 10, 10, 10, 10, 7, 13, 9, 5, 9, 17, 9, 9, 20, 10, 10, 5, 10, 5, 10, 7, 9,
+	5, 9, 9, 9, 20, 10, 10, 5, 10, 5, 10, 7, 9, 5, 9, 5, 9, 9, 20, 10, 5, 9, 20, 10,
+	10, 10, 13, 7, 17, 9, 9, 9, 20, 10, 10, 10, 7, 9, 9, 9, 20, 10, 10, 10, 10, 5, 9, 7,
+	9, 9, 9, 20, 10, 10, 10, 5, 13, 7, 17, 9, 9, 9, 20, 10, 10, 10, 5, 10, 5, 9, 7, 9,
+	9, 9, 20, 10, 10, 5, 9, 5, 9, 20, 10, 10, 10, 13, 5, 9, 9, 17, 9, 20, 10, 10, 10, 5,
+	9, 5, 9, 5, 9, 20, 10, 10, 10, 10, 5, 13, 9, 9, 9, 17, 9, 20, 10, 10, 10, 5, 13, 5,
+	9, 9, 17, 9, 20, 10, 10, 10, 5, 10, 5, 13, 9, 9, 9, 17, 9, 20, 10, 10, 5, 10, 7, 9,
+	9, 9, 20, 10, 10, 10, 10, 7, 9, 7, 9, 9, 9, 20, 10, 10, 5, 10, 5, 9, 5, 9, 5, 9,
+	20, 10, 10, 10, 10, 7, 13, 9, 9, 9, 17, 9, 20, 10, 10, 10, 5, 10, 7, 9, 7, 9, 9, 9,
+	20, 10, 10, 10, 5, 10, 7, 13, 9, 9, 9, 17, 9, 20, 10, 10, 5, 10, 5, 13, 7, 17, 9, 9,
+	9, 20, 10, 10, 5, 10, 5, 10, 5, 9, 7, 9, 9, 9, 20, 10, 10, 5, 10, 5, 13, 5, 9, 9,
+	17, 9, 20, 10, 10, 10, 10, 7, 13, 9, 5, 9, 9, 17, 9, 20, 10, 10, 5, 10, 5, 10, 7, 9,
+	7, 9, 9, 9, 20, 10, 10, 5, 10, 5, 10, 7, 13, 9, 9, 9, 17, 9, 20, 10, 5, 10, 5, 9,
+	9, 20, 10, 10, 10, 13, 7, 9, 17, 9, 9, 20, 10, 10, 10, 7, 9, 5, 9, 9, 20, 10, 10, 10,
+	10, 5, 9, 7, 9, 5, 9, 9, 20, 10, 10, 10, 5, 13, 7, 9, 17, 9, 9, 20, 10, 10, 10, 5,
+	10, 5, 9, 7, 9, 5, 9, 9, 20, 10, 5, 10, 5, 9, 5, 9, 20, 10, 10, 10, 13, 7, 9, 9,
+	17, 9, 20, 10, 10, 10, 7, 9, 5, 9, 5, 9, 20, 10, 10, 13, 15, 5, 10, 19, 9, 17, 9, 9,
+	20, 10, 10, 10, 5, 13, 7, 9, 9, 17, 9, 20, 10, 10, 10, 7, 10, 5, 13, 9, 9, 9, 17, 9,
+	20, 10, 10, 5, 10, 7, 9, 5, 9, 9, 20, 10, 10, 10, 10, 5, 15, 9, 9, 19, 9, 9, 20, 10,
+	10, 5, 10, 7, 9, 5, 9, 5, 9, 20, 10, 10, 5, 13, 15, 5, 10, 19, 9, 17, 9, 9, 20, 10,
+	10, 10, 5, 10, 5, 15, 9, 9, 19, 9, 9, 20, 10, 10, 10, 5, 10, 5, 15, 9, 9, 18, 9, 17,
+	9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 17, 9, 9, 20, 10, 10, 10, 10, 5, 15, 9, 5, 9, 19,
+	9, 9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 9, 17, 9, 20, 10, 10, 10, 10, 7, 13, 9, 7, 9,
+	9, 17, 9, 20, 10, 10, 5, 10, 5, 10, 5, 15, 9, 9, 19, 9, 9, 20, 10, 10, 10, 5, 10, 7,
+	13, 9, 7, 9, 9, 17, 9, 20, 10, 5, 10, 5, 10, 5, 9, 9, 9, 20, 10, 10, 10, 13, 7, 9,
+	5, 17, 9, 9, 20, 10, 5, 10, 5, 10, 5, 9, 5, 9, 9, 20, 10, 10, 10, 13, 7, 9, 5, 17,
+	5, 9, 9, 20, 10, 10, 10, 5, 13, 7, 9, 5, 17, 9, 9, 20, 10, 10, 10, 5, 13, 7, 9, 5,
+	17, 5, 9, 9, 20, 10, 5, 10, 5, 10, 7, 9, 9, 9, 20, 10, 10, 10, 13, 7, 9, 5, 9, 17,
+	9, 20, 10, 10, 10, 7, 13, 9, 5, 9, 17, 9, 20, 10, 5, 10, 10, 10, 7, 13, 9, 9, 9, 17,
+	9, 20, 10, 10, 10, 5, 13, 7, 9, 5, 9, 17, 9, 20, 10, 10, 10, 7, 10, 7, 13, 9, 9, 9,
+	17, 9, 20, 10, 5, 10, 5, 10, 7, 9, 5, 9, 9, 20, 10, 10, 10, 13, 7, 9, 5, 9, 5, 17,
+	9, 20, 10, 5, 10, 5, 10, 7, 9, 5, 9, 5, 9, 20, 10, 10, 10, 13, 7, 9, 5, 9, 5, 17,
+	5, 9, 20, 10, 10, 10, 5, 13, 7, 9, 5, 9, 5, 17, 9, 20, 10, 10, 10, 5, 13, 7, 9, 5,
+	9, 5, 17, 5, 9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 5, 17, 9, 9, 20, 10, 10, 5, 10, 5,
+	13, 7, 9, 5, 17, 5, 9, 9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 5, 9, 17, 9, 20, 10, 10,
+	5, 10, 7, 10, 7, 13, 9, 9, 9, 17, 9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17,
+	9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17, 5, 9, 20, 10, 10, 10, 13, 15, 9, 5,
+	17, 19, 9, 9, 20, 10, 10, 10, 13, 5, 15, 9, 5, 17, 19, 9, 9, 20, 10, 13, 10, 10, 10, 17,
+	7, 9, 9, 9, 9, 20, 10, 10, 13, 10, 7, 13, 9, 5, 9, 17, 17, 9, 20, 10, 13, 10, 10, 10,
+	17, 7, 9, 5, 9, 9, 9, 20, 10, 10, 10, 7, 10, 7, 13, 9, 5, 9, 17, 9, 9, 20, 10, 10,
+	10, 13, 15, 9, 5, 19, 9, 17, 9, 20, 10, 10, 10, 13, 5, 15, 9, 5, 19, 9, 17, 9, 20, 10,
+	5, 10, 5, 10, 5, 13, 5, 9, 9, 17, 9, 20, 10, 5, 10, 10, 10, 7, 13, 9, 5, 9, 9, 17,
+	9, 20, 10, 13, 10, 10, 10, 17, 7, 9, 7, 9, 9, 9, 20, 10, 10, 10, 7, 10, 7, 13, 9, 5,
+	9, 9, 17, 9, 20, 10, 5, 10, 5, 10, 5, 13, 7, 9, 17, 9, 9, 20, 10, 10, 10, 13, 7, 13,
+	9, 5, 9, 17, 17, 9, 20, 10, 5, 10, 5, 10, 5, 13, 7, 9, 9, 17, 9, 20, 10, 5, 10, 10,
+	10, 7, 13, 9, 7, 9, 9, 17, 9, 20, 10, 10, 10, 5, 13, 7, 13, 9, 5, 9, 17, 17, 9, 20,
+	10, 10, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 9, 20, 10, 5, 10, 5, 10, 5, 13, 7, 9, 5,
+	17, 9, 9, 20, 10, 10, 10, 13, 7, 10, 15, 9, 9, 19, 9, 17, 9, 20, 10, 5, 10, 5, 10, 5,
+	13, 7, 9, 5, 9, 17, 9, 20, 10, 10, 10, 13, 7, 10, 15, 9, 9, 17, 19, 9, 9, 20, 10, 5,
+	10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17, 9, 20, 10, 10, 5, 10, 7, 10, 7, 13, 9, 7, 9,
+	9, 17, 9, 20, 5, 20, 10, 10, 10, 15, 7, 19, 9, 9, 9, 20, 10, 10, 13, 7, 17, 9, 9, 20,
+	10, 10, 10, 15, 7, 19, 5, 9, 9, 9, 20, 10, 10, 10, 5, 15, 7, 19, 9, 9, 9, 20, 10, 10,
+	10, 5, 15, 7, 19, 5, 9, 9, 9, 20, 10, 10, 7, 9, 9, 20, 10, 13, 10, 10, 7, 9, 9, 9,
+	17, 20, 10, 10, 10, 5, 9, 7, 9, 9, 20, 10, 10, 10, 10, 5, 9, 5, 9, 7, 9, 9, 20, 10,
+	10, 13, 7, 10, 5, 17, 9, 9, 9, 20, 10, 10, 10, 5, 10, 5, 9, 5, 9, 7, 9, 9, 20, 10,
+	10, 5, 13, 7, 17, 9, 9, 20, 10, 10, 10, 13, 5, 9, 7, 17, 9, 9, 20, 10, 10, 5, 10, 5,
+	9, 7, 9, 9, 20, 10, 10, 10, 10, 7, 9, 5, 9, 7, 9, 9, 20, 10, 10, 10, 5, 13, 5, 9,
+	7, 17, 9, 9, 20, 10, 10, 10, 5, 10, 7, 9, 5, 9, 7, 9, 9, 20, 10, 10, 5, 10, 5, 15,
+	7, 19, 9, 9, 9, 20, 10, 10, 5, 10, 5, 15, 7, 19, 5, 9, 9, 9, 20, 10, 10, 5, 13, 7,
+	10, 5, 17, 9, 9, 9, 20, 10, 13, 10, 10, 7, 13, 9, 5, 9, 17, 9, 17, 20, 10, 10, 5, 10,
+	5, 13, 5, 9, 7, 17, 9, 9, 20, 10, 10, 5, 10, 5, 10, 7, 9, 5, 9, 7, 9, 9, 20, 10,
+	5, 9, 5, 20, 10, 10, 13, 10, 5, 9, 9, 9, 17, 20, 10, 10, 13, 5, 9, 9, 17, 20, 10, 10,
+	13, 10, 5, 9, 5, 9, 9, 17, 20, 10, 10, 10, 7, 15, 7, 19, 9, 9, 9, 20, 10, 10, 10, 7,
+	15, 7, 19, 5, 9, 9, 9, 20, 10, 10, 5, 9, 5, 9, 5, 20, 10, 10, 10, 13, 5, 9, 9, 9,
+	17, 20, 10, 10, 10, 5, 13, 9, 9, 9, 17, 20, 10, 10, 10, 10, 5, 13, 9, 9, 9, 9, 17, 20,
+	10, 10, 10, 5, 13, 5, 9, 9, 9, 17, 20, 10, 10, 10, 5, 10, 5, 13, 9, 9, 9, 9, 17, 20,
+	10, 10, 5, 13, 5, 9, 9, 17, 20, 10, 10, 10, 13, 5, 9, 5, 9, 9, 17, 20, 10, 10, 5, 10,
+	5, 13, 9, 9, 9, 17, 20, 10, 10, 10, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10, 10, 5, 13,
+	5, 9, 5, 9, 9, 17, 20, 10, 10, 10, 5, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10, 5, 10,
+	7, 15, 7, 19, 9, 9, 9, 20, 10, 10, 5, 10, 7, 15, 7, 19, 5, 9, 9, 9, 20, 10, 10, 5,
+	10, 5, 13, 5, 9, 9, 9, 17, 20, 10, 10, 10, 10, 7, 13, 9, 5, 9, 9, 9, 17, 20, 10, 10,
+	5, 10, 5, 13, 5, 9, 5, 9, 9, 17, 20, 10, 10, 5, 10, 5, 10, 7, 13, 9, 9, 9, 9, 17,
+	20, 10, 5, 10, 7, 9, 9, 20, 10, 10, 13, 10, 7, 9, 9, 9, 17, 20, 10, 10, 10, 7, 9, 7,
+	9, 9, 20, 10, 10, 10, 10, 5, 9, 7, 9, 7, 9, 9, 20, 10, 10, 13, 5, 10, 7, 9, 9, 9,
+	17, 20, 10, 10, 10, 5, 10, 5, 9, 7, 9, 7, 9, 9, 20, 10, 5, 10, 5, 9, 5, 9, 5, 20,
+	10, 10, 10, 13, 7, 9, 9, 9, 17, 20, 10, 10, 10, 7, 13, 9, 9, 9, 17, 20, 13, 10, 13, 15,
+	5, 10, 19, 9, 17, 17, 9, 20, 10, 10, 10, 5, 13, 7, 9, 9, 9, 17, 20, 10, 10, 10, 7, 10,
+	5, 13, 9, 9, 9, 9, 17, 20, 10, 10, 5, 10, 7, 9, 7, 9, 9, 20, 10, 10, 10, 10, 7, 9,
+	7, 9, 7, 9, 9, 20, 10, 10, 5, 10, 7, 13, 9, 9, 9, 17, 20, 10, 10, 7, 15, 15, 5, 10,
+	19, 9, 19, 9, 9, 20, 10, 10, 10, 5, 10, 7, 9, 7, 9, 7, 9, 9, 20, 10, 10, 10, 5, 10,
+	5, 15, 9, 9, 18, 9, 9, 17, 20, 10, 10, 5, 13, 5, 10, 7, 9, 9, 9, 17, 20, 10, 10, 10,
+	13, 5, 13, 9, 5, 9, 17, 9, 17, 20, 10, 10, 5, 10, 5, 13, 7, 9, 9, 9, 17, 20, 10, 10,
+	10, 10, 7, 13, 9, 7, 9, 9, 9, 17, 20, 10, 10, 5, 10, 5, 10, 7, 9, 7, 9, 7, 9, 9,
+	20, 10, 10, 10, 5, 10, 7, 13, 9, 7, 9, 9, 9, 17, 20, 10, 5, 10, 5, 13, 7, 17, 9, 9,
+	20, 10, 10, 10, 13, 7, 9, 7, 17, 9, 9, 20, 10, 5, 10, 5, 10, 5, 9, 7, 9, 9, 20, 10,
+	10, 10, 13, 7, 9, 5, 17, 7, 9, 9, 20, 10, 10, 10, 5, 13, 7, 9, 7, 17, 9, 9, 20, 10,
+	10, 10, 5, 13, 7, 9, 5, 17, 7, 9, 9, 20, 10, 5, 10, 5, 13, 5, 9, 9, 17, 20, 10, 10,
+	10, 13, 7, 9, 5, 9, 9, 17, 20, 10, 10, 10, 7, 13, 9, 5, 9, 9, 17, 20, 10, 5, 10, 10,
+	10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10, 10, 5, 13, 7, 9, 5, 9, 9, 17, 20, 10, 10, 10,
+	7, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 5, 10, 5, 10, 7, 9, 7, 9, 9, 20, 10, 10, 10,
+	13, 7, 9, 5, 9, 5, 9, 17, 20, 10, 5, 10, 5, 10, 7, 13, 9, 9, 9, 17, 20, 10, 13, 10,
+	10, 5, 17, 7, 13, 9, 9, 9, 17, 20, 10, 10, 10, 5, 13, 7, 9, 5, 9, 5, 9, 17, 20, 10,
+	10, 10, 7, 10, 5, 15, 9, 9, 18, 9, 9, 17, 20, 10, 10, 5, 10, 5, 13, 7, 9, 7, 17, 9,
+	9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 5, 17, 7, 9, 9, 20, 10, 10, 5, 10, 5, 13, 7, 9,
+	5, 9, 9, 17, 20, 10, 10, 5, 10, 7, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10, 5, 10, 5,
+	13, 7, 9, 5, 9, 5, 9, 17, 20, 10, 10, 5, 10, 7, 10, 5, 15, 9, 9, 18, 9, 9, 17, 20,
+	10, 10, 13, 10, 15, 9, 5, 19, 9, 9, 17, 20, 10, 10, 10, 13, 7, 13, 9, 7, 17, 17, 9, 9,
+	20, 13, 13, 10, 10, 10, 17, 7, 9, 9, 17, 9, 20, 10, 10, 13, 10, 7, 13, 9, 5, 9, 17, 9,
+	17, 20, 13, 13, 10, 10, 10, 17, 7, 9, 5, 9, 17, 9, 20, 10, 10, 13, 5, 10, 7, 13, 9, 5,
+	9, 17, 9, 17, 20, 10, 10, 10, 13, 15, 9, 5, 19, 9, 9, 17, 20, 10, 10, 10, 13, 5, 15, 9,
+	5, 19, 9, 9, 17, 20, 10, 5, 10, 5, 10, 5, 13, 5, 9, 9, 9, 17, 20, 10, 5, 10, 10, 10,
+	7, 13, 9, 5, 9, 9, 9, 17, 20, 13, 13, 10, 10, 10, 17, 7, 9, 7, 9, 17, 9, 20, 10, 10,
+	10, 7, 10, 7, 13, 9, 5, 9, 9, 9, 17, 20, 10, 5, 10, 5, 13, 5, 10, 7, 9, 9, 9, 17,
+	20, 10, 10, 10, 13, 7, 13, 9, 5, 9, 17, 9, 17, 20, 10, 5, 10, 5, 10, 5, 13, 7, 9, 9,
+	9, 17, 20, 10, 5, 10, 10, 10, 7, 13, 9, 7, 9, 9, 9, 17, 20, 10, 10, 10, 5, 13, 7, 13,
+	9, 5, 9, 17, 9, 17, 20, 10, 10, 10, 7, 10, 7, 13, 9, 7, 9, 9, 9, 17, 20, 10, 5, 10,
+	5, 10, 5, 13, 7, 9, 7, 17, 9, 9, 20, 10, 10, 10, 13, 7, 10, 15, 9, 9, 19, 9, 9, 17,
+	20, 10, 5, 10, 5, 10, 5, 13, 7, 9, 5, 9, 9, 17, 20, 13, 10, 10, 13, 7, 10, 15, 9, 9,
+	17, 17, 19, 9, 20, 10, 5, 10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 9, 17, 20, 10, 10, 5, 10,
+	7, 10, 7, 13, 9, 7, 9, 9, 9, 17, 20, 5, 10, 5, 9, 20, 10, 10, 13, 13, 7, 17, 9, 17,
+	9, 20, 10, 10, 13, 7, 9, 17, 9, 20, 10, 10, 10, 15, 7, 19, 7, 9, 9, 9, 20, 10, 10, 13,
+	5, 13, 7, 17, 9, 17, 9, 20, 10, 10, 10, 5, 15, 7, 19, 7, 9, 9, 9, 20, 10, 10, 7, 9,
+	5, 9, 20, 10, 13, 10, 13, 5, 9, 9, 17, 17, 20, 10, 10, 10, 5, 9, 7, 9, 5, 9, 20, 10,
+	13, 10, 10, 5, 13, 9, 9, 9, 17, 17, 20, 10, 10, 10, 7, 15, 5, 9, 9, 19, 9, 20, 10, 10,
+	10, 7, 10, 7, 15, 9, 9, 9, 19, 9, 20, 10, 10, 5, 13, 7, 9, 17, 9, 20, 10, 10, 10, 13,
+	5, 9, 7, 9, 17, 9, 20, 10, 10, 5, 10, 5, 9, 7, 9, 5, 9, 20, 10, 13, 10, 10, 7, 13,
+	9, 9, 9, 17, 17, 20, 10, 10, 10, 5, 13, 5, 9, 7, 9, 17, 9, 20, 10, 13, 10, 5, 10, 7,
+	13, 9, 9, 9, 17, 17, 20, 10, 10, 5, 13, 5, 13, 7, 17, 9, 17, 9, 20, 10, 10, 5, 10, 5,
+	15, 7, 19, 7, 9, 9, 9, 20, 10, 10, 5, 10, 7, 15, 5, 9, 9, 19, 9, 20, 10, 13, 10, 10,
+	7, 13, 9, 5, 9, 9, 17, 17, 20, 10, 10, 5, 10, 5, 13, 5, 9, 7, 9, 17, 9, 20, 10, 10,
+	7, 10, 5, 10, 7, 13, 9, 9, 9, 17, 9, 20, 5, 10, 5, 9, 5, 20, 10, 10, 13, 13, 7, 17,
+	9, 9, 17, 20, 10, 10, 13, 7, 9, 9, 17, 20, 10, 10, 13, 10, 5, 9, 7, 9, 9, 17, 20, 10,
+	10, 13, 5, 13, 7, 17, 9, 9, 17, 20, 10, 10, 10, 7, 15, 7, 19, 7, 9, 9, 9, 20, 10, 10,
+	7, 9, 5, 9, 5, 20, 10, 13, 13, 10, 7, 17, 9, 17, 9, 20, 10, 13, 15, 5, 10, 19, 9, 17,
+	9, 20, 10, 13, 13, 15, 5, 10, 17, 19, 9, 17, 9, 20, 10, 13, 13, 5, 10, 7, 17, 9, 17, 9,
+	20, 10, 13, 13, 5, 15, 5, 10, 17, 19, 9, 17, 9, 20, 10, 10, 5, 13, 7, 9, 9, 17, 20, 10,
+	10, 10, 13, 5, 9, 7, 9, 9, 17, 20, 10, 10, 7, 10, 5, 13, 9, 9, 9, 17, 20, 5, 10, 10,
+	10, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10, 10, 5, 13, 5, 9, 7, 9, 9, 17, 20, 5, 10,
+	10, 10, 5, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10, 5, 13, 5, 13, 7, 17, 9, 9, 17, 20,
+	10, 10, 5, 10, 7, 15, 7, 19, 7, 9, 9, 9, 20, 10, 10, 7, 10, 5, 13, 5, 9, 9, 9, 17,
+	20, 13, 10, 15, 10, 5, 10, 17, 7, 9, 19, 9, 9, 20, 10, 10, 5, 10, 5, 13, 5, 9, 7, 9,
+	9, 17, 20, 10, 10, 7, 10, 5, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 5, 10, 7, 9, 5, 9,
+	20, 10, 10, 10, 15, 5, 9, 9, 19, 9, 20, 10, 10, 10, 5, 15, 9, 9, 19, 9, 20, 10, 10, 10,
+	10, 7, 15, 9, 9, 9, 19, 9, 20, 10, 10, 10, 5, 15, 5, 9, 9, 19, 9, 20, 10, 10, 10, 5,
+	10, 7, 15, 9, 9, 9, 19, 9, 20, 10, 5, 10, 7, 9, 5, 9, 5, 20, 10, 15, 10, 10, 7, 19,
+	9, 9, 9, 20, 10, 5, 13, 15, 5, 10, 19, 9, 17, 9, 20, 10, 15, 10, 15, 5, 10, 19, 19, 9,
+	9, 9, 20, 10, 15, 10, 5, 10, 7, 19, 9, 9, 9, 20, 10, 15, 10, 5, 15, 5, 10, 19, 19, 9,
+	9, 9, 20, 10, 10, 5, 10, 5, 15, 9, 9, 19, 9, 20, 10, 10, 10, 10, 5, 15, 9, 9, 9, 19,
+	9, 20, 10, 10, 5, 10, 5, 15, 9, 9, 18, 9, 17, 20, 10, 10, 10, 10, 5, 15, 9, 9, 9, 18,
+	9, 17, 20, 10, 10, 10, 5, 10, 5, 15, 9, 9, 9, 19, 9, 20, 10, 10, 10, 5, 10, 5, 15, 9,
+	9, 9, 18, 9, 17, 20, 10, 10, 5, 10, 5, 15, 5, 9, 9, 19, 9, 20, 10, 10, 10, 10, 5, 15,
+	9, 5, 9, 9, 19, 9, 20, 10, 13, 15, 10, 10, 17, 7, 19, 9, 9, 9, 20, 10, 13, 15, 10, 5,
+	10, 17, 7, 19, 9, 9, 9, 20, 10, 10, 5, 10, 5, 10, 5, 15, 9, 9, 9, 19, 9, 20, 10, 10,
+	10, 10, 7, 10, 15, 9, 9, 9, 9, 19, 9, 20, 10, 5, 10, 5, 13, 7, 9, 17, 9, 20, 10, 10,
+	10, 13, 7, 9, 7, 9, 17, 9, 20, 10, 10, 10, 5, 15, 9, 5, 9, 19, 9, 20, 10, 10, 13, 10,
+	7, 13, 9, 9, 9, 17, 17, 20, 10, 10, 10, 5, 13, 7, 9, 7, 9, 17, 9, 20, 10, 10, 13, 5,
+	10, 7, 13, 9, 9, 9, 17, 17, 20, 10, 5, 10, 5, 13, 7, 9, 9, 17, 20, 10, 10, 10, 13, 7,
+	9, 7, 9, 9, 17, 20, 10, 10, 10, 7, 13, 9, 7, 9, 9, 17, 20, 10, 10, 13, 10, 7, 10, 14,
+	9, 9, 9, 19, 9, 20, 10, 10, 10, 5, 13, 7, 9, 7, 9, 9, 17, 20, 10, 10, 10, 7, 10, 5,
+	13, 9, 9, 7, 9, 9, 17, 20, 10, 5, 10, 5, 10, 5, 15, 9, 9, 19, 9, 20, 10, 10, 10, 13,
+	7, 13, 9, 9, 9, 17, 17, 20, 10, 10, 5, 10, 7, 13, 9, 7, 9, 9, 17, 20, 10, 10, 10, 13,
+	7, 10, 14, 9, 9, 9, 19, 9, 20, 10, 10, 10, 5, 13, 7, 13, 9, 9, 9, 17, 17, 20, 10, 10,
+	10, 5, 13, 7, 10, 14, 9, 9, 9, 19, 9, 20, 10, 10, 5, 10, 5, 13, 7, 9, 7, 9, 17, 9,
+	20, 10, 10, 5, 13, 5, 10, 7, 13, 9, 9, 9, 17, 17, 20, 10, 10, 5, 10, 5, 13, 7, 9, 7,
+	9, 9, 17, 20, 10, 10, 10, 10, 7, 13, 9, 7, 9, 7, 9, 9, 17, 20, 10, 10, 5, 10, 5, 13,
+	7, 13, 9, 9, 9, 17, 17, 20, 10, 10, 5, 10, 5, 13, 7, 10, 14, 9, 9, 9, 19, 9, 20, 10,
+	10, 10, 13, 15, 9, 5, 17, 9, 19, 9, 20, 10, 10, 10, 13, 5, 15, 9, 5, 17, 9, 19, 9, 20,
+	13, 13, 10, 10, 10, 17, 7, 9, 17, 9, 9, 20, 10, 10, 13, 10, 7, 13, 9, 5, 9, 9, 17, 17,
+	20, 13, 13, 10, 10, 10, 17, 7, 9, 5, 17, 9, 9, 20, 10, 10, 13, 5, 10, 7, 13, 9, 5, 9,
+	9, 17, 17, 20, 10, 10, 13, 10, 15, 9, 5, 17, 9, 19, 9, 20, 10, 10, 10, 13, 7, 13, 9, 7,
+	17, 9, 9, 17, 20, 10, 5, 10, 7, 10, 5, 13, 5, 9, 9, 9, 17, 20, 10, 10, 13, 10, 7, 10,
+	14, 9, 5, 9, 9, 19, 9, 20, 13, 13, 10, 10, 10, 17, 7, 9, 7, 17, 9, 9, 20, 10, 10, 13,
+	10, 7, 10, 15, 9, 9, 17, 9, 19, 9, 20, 10, 5, 10, 5, 10, 5, 15, 5, 9, 9, 19, 9, 20,
+	10, 10, 10, 13, 7, 13, 9, 5, 9, 9, 17, 17, 20, 10, 5, 13, 15, 10, 10, 17, 7, 19, 9, 9,
+	9, 20, 10, 5, 13, 15, 10, 5, 10, 17, 7, 19, 9, 9, 9, 20, 10, 10, 10, 5, 13, 7, 13, 9,
+	5, 9, 9, 17, 17, 20, 13, 10, 13, 15, 10, 10, 19, 9, 7, 17, 17, 9, 9, 20, 10, 5, 10, 5,
+	10, 5, 13, 7, 9, 7, 9, 17, 9, 20, 10, 10, 10, 13, 7, 13, 9, 5, 9, 5, 9, 17, 17, 20,
+	10, 5, 10, 5, 10, 5, 13, 7, 9, 7, 9, 9, 17, 20, 10, 10, 10, 13, 7, 10, 15, 9, 9, 17,
+	9, 19, 9, 20, 10, 5, 10, 5, 10, 5, 13, 7, 13, 9, 9, 9, 17, 17, 20, 10, 10, 7, 15, 15,
+	10, 10, 19, 9, 7, 19, 9, 9, 9, 20, 5, 10, 5, 10, 5, 9, 9, 20, 10, 10, 10, 15, 7, 9,
+	19, 9, 9, 20, 10, 10, 13, 7, 9, 5, 17, 9, 20, 10, 10, 10, 15, 7, 19, 7, 9, 5, 9, 9,
+	20, 10, 10, 10, 5, 15, 7, 9, 19, 9, 9, 20, 10, 10, 10, 5, 15, 7, 19, 7, 9, 5, 9, 9,
+	20, 5, 10, 5, 10, 5, 9, 5, 9, 20, 10, 13, 10, 13, 7, 9, 9, 17, 17, 20, 10, 10, 13, 7,
+	9, 5, 17, 5, 9, 20, 10, 13, 13, 15, 5, 10, 19, 9, 17, 9, 17, 20, 10, 10, 10, 7, 15, 7,
+	9, 9, 19, 9, 20, 10, 10, 13, 7, 15, 5, 10, 19, 9, 17, 9, 9, 20, 10, 10, 5, 13, 7, 9,
+	5, 17, 9, 20, 10, 10, 10, 13, 5, 9, 7, 9, 5, 17, 9, 20, 10, 10, 5, 13, 7, 9, 5, 17,
+	5, 9, 20, 10, 10, 7, 13, 15, 5, 10, 19, 9, 17, 9, 9, 20, 10, 10, 10, 5, 13, 5, 9, 7,
+	9, 5, 17, 9, 20, 10, 10, 10, 5, 13, 5, 9, 7, 9, 5, 17, 5, 9, 20, 10, 10, 5, 10, 5,
+	15, 7, 9, 19, 9, 9, 20, 10, 10, 10, 10, 5, 15, 9, 7, 9, 19, 9, 9, 20, 10, 10, 5, 10,
+	7, 15, 7, 9, 9, 19, 9, 20, 10, 13, 10, 10, 7, 13, 9, 7, 9, 9, 17, 17, 20, 10, 10, 5,
+	10, 5, 13, 5, 9, 7, 9, 5, 17, 9, 20, 10, 13, 10, 5, 10, 7, 13, 9, 7, 9, 9, 17, 17,
+	20, 5, 10, 5, 10, 7, 9, 9, 20, 10, 10, 13, 13, 7, 9, 17, 9, 17, 20, 10, 10, 13, 7, 9,
+	5, 9, 17, 20, 10, 10, 10, 15, 7, 19, 7, 9, 7, 9, 9, 20, 10, 10, 10, 7, 15, 7, 9, 19,
+	9, 9, 20, 10, 10, 10, 5, 15, 7, 19, 7, 9, 7, 9, 9, 20, 10, 10, 7, 13, 9, 5, 9, 17,
+	20, 10, 10, 15, 10, 7, 9, 19, 9, 9, 20, 5, 10, 10, 10, 7, 13, 9, 9, 9, 17, 20, 10, 10,
+	15, 15, 5, 10, 19, 9, 19, 9, 9, 20, 10, 10, 15, 5, 10, 7, 9, 19, 9, 9, 20, 10, 10, 13,
+	15, 5, 10, 17, 7, 9, 19, 9, 9, 20, 10, 10, 5, 13, 7, 9, 5, 9, 17, 20, 10, 10, 10, 13,
+	5, 9, 7, 9, 5, 9, 17, 20, 10, 10, 7, 10, 7, 13, 9, 9, 9, 17, 20, 10, 10, 5, 15, 15,
+	5, 10, 19, 9, 19, 9, 9, 20, 10, 10, 10, 5, 13, 5, 9, 7, 9, 5, 9, 17, 20, 10, 10, 13,
+	7, 10, 5, 17, 7, 13, 9, 9, 9, 17, 20, 10, 10, 5, 10, 7, 15, 7, 9, 19, 9, 9, 20, 10,
+	10, 10, 13, 5, 13, 9, 7, 9, 17, 9, 17, 20, 10, 10, 5, 15, 5, 10, 7, 9, 19, 9, 9, 20,
+	5, 10, 10, 10, 10, 7, 13, 9, 7, 9, 9, 9, 17, 20, 10, 10, 5, 10, 5, 13, 5, 9, 7, 9,
+	5, 9, 17, 20, 10, 13, 10, 10, 7, 10, 15, 9, 9, 9, 17, 19, 9, 20, 5, 10, 5, 10, 7, 9,
+	5, 9, 20, 10, 10, 10, 15, 7, 9, 9, 19, 9, 20, 10, 10, 13, 7, 9, 5, 9, 5, 17, 20, 10,
+	15, 10, 13, 5, 10, 19, 9, 17, 9, 9, 20, 10, 10, 10, 5, 15, 7, 9, 9, 19, 9, 20, 10, 10,
+	10, 10, 7, 15, 9, 7, 9, 9, 19, 9, 20, 5, 10, 5, 10, 7, 9, 5, 9, 5, 20, 5, 10, 15,
+	10, 10, 7, 19, 9, 9, 9, 20, 10, 10, 13, 7, 9, 5, 9, 5, 17, 5, 20, 5, 10, 15, 10, 15,
+	5, 10, 19, 19, 9, 9, 9, 20, 5, 10, 15, 10, 5, 10, 7, 19, 9, 9, 9, 20, 10, 13, 10, 15,
+	5, 10, 17, 7, 9, 19, 9, 9, 20, 10, 10, 5, 13, 7, 9, 5, 9, 5, 17, 20, 10, 13, 15, 10,
+	5, 10, 19, 9, 17, 9, 9, 20, 10, 10, 5, 13, 7, 9, 5, 9, 5, 17, 5, 20, 10, 10, 15, 10,
+	7, 19, 7, 13, 9, 9, 9, 17, 20, 10, 13, 13, 15, 10, 10, 17, 19, 9, 17, 9, 9, 20, 10, 10,
+	15, 5, 10, 7, 19, 7, 13, 9, 9, 9, 17, 20, 10, 10, 5, 10, 5, 15, 7, 9, 9, 19, 9, 20,
+	10, 10, 10, 10, 5, 15, 9, 7, 9, 9, 19, 9, 20, 13, 10, 15, 10, 10, 17, 7, 19, 9, 9, 9,
+	20, 13, 10, 15, 10, 5, 10, 17, 7, 19, 9, 9, 9, 20, 10, 10, 7, 10, 5, 10, 5, 15, 9, 9,
+	9, 19, 9, 20, 13, 10, 13, 15, 10, 10, 17, 17, 7, 19, 9, 9, 9, 20, 10, 5, 10, 5, 13, 7,
+	9, 5, 17, 9, 20, 10, 10, 10, 13, 5, 15, 9, 9, 17, 19, 9, 20, 10, 5, 10, 5, 13, 7, 9,
+	5, 17, 5, 9, 20, 10, 10, 10, 13, 5, 15, 9, 9, 17, 19, 5, 9, 20, 10, 10, 10, 5, 13, 5,
+	15, 9, 9, 17, 19, 9, 20, 10, 10, 10, 5, 13, 5, 15, 9, 9, 17, 19, 5, 9, 20, 10, 5, 10,
+	5, 13, 7, 9, 5, 9, 17, 20, 10, 10, 10, 13, 5, 15, 9, 9, 19, 9, 17, 20, 10, 5, 10, 7,
+	10, 7, 13, 9, 9, 9, 17, 20, 10, 10, 13, 13, 5, 10, 14, 9, 9, 17, 19, 9, 20, 10, 10, 10,
+	5, 13, 5, 15, 9, 9, 19, 9, 17, 20, 10, 10, 10, 10, 7, 13, 15, 9, 9, 9, 19, 9, 17, 20,
+	10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17, 20, 10, 5, 13, 15, 10, 5, 10, 19, 9, 17, 9, 9,
+	20, 10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17, 5, 20, 10, 15, 10, 10, 7, 19, 5, 13, 9, 9,
+	9, 17, 20, 10, 15, 10, 15, 10, 10, 19, 19, 9, 9, 9, 9, 20, 10, 15, 10, 5, 10, 7, 19, 5,
+	13, 9, 9, 9, 17, 20, 10, 10, 10, 10, 13, 15, 9, 9, 9, 17, 19, 9, 20, 10, 10, 10, 10, 5,
+	13, 15, 9, 9, 9, 17, 19, 9, 20, 10, 10, 10, 10, 13, 15, 9, 9, 9, 19, 9, 17, 20, 10, 10,
+	10, 10, 5, 13, 15, 9, 9, 9, 19, 9, 17, 20, 10, 10, 10, 10, 13, 15, 9, 9, 9, 18, 9, 17,
+	17, 20, 10, 10, 7, 15, 15, 10, 10, 19, 9, 19, 9, 7, 9, 9, 20, 10, 10, 10, 13, 15, 9, 5,
+	9, 17, 19, 9, 20, 10, 10, 10, 13, 5, 15, 9, 5, 9, 17, 19, 9, 20, 13, 13, 10, 10, 10, 17,
+	7, 17, 9, 9, 9, 20, 10, 10, 13, 10, 7, 13, 9, 7, 9, 9, 17, 17, 20, 10, 10, 10, 5, 13,
+	5, 15, 9, 5, 9, 17, 19, 9, 20, 10, 10, 13, 5, 10, 7, 13, 9, 7, 9, 9, 17, 17, 20, 10,
+	10, 10, 13, 15, 9, 5, 9, 19, 9, 17, 20, 10, 10, 10, 13, 5, 15, 9, 5, 9, 19, 9, 17, 20,
+	10, 5, 10, 5, 15, 5, 10, 7, 9, 19, 9, 9, 20, 10, 10, 10, 15, 5, 9, 5, 10, 7, 9, 19,
+	9, 9, 20, 10, 10, 10, 5, 13, 5, 15, 9, 5, 9, 19, 9, 17, 20, 10, 10, 13, 10, 7, 10, 15,
+	9, 9, 9, 17, 19, 9, 20, 10, 5, 10, 5, 10, 5, 15, 7, 9, 9, 19, 9, 20, 10, 10, 10, 13,
+	7, 13, 9, 7, 9, 9, 17, 17, 20, 10, 10, 10, 7, 10, 15, 9, 7, 9, 9, 19, 9, 20, 10, 10,
+	10, 13, 7, 10, 14, 9, 7, 9, 9, 19, 9, 20, 10, 10, 10, 5, 13, 7, 13, 9, 7, 9, 9, 17,
+	17, 20, 13, 13, 10, 15, 10, 10, 17, 17, 7, 19, 9, 9, 9, 20, 10, 5, 10, 10, 10, 13, 15, 9,
+	9, 9, 17, 19, 9, 20, 10, 10, 10, 13, 7, 10, 15, 9, 9, 9, 19, 9, 17, 20, 10, 5, 10, 10,
+	10, 13, 15, 9, 9, 9, 19, 9, 17, 20, 10, 10, 10, 13, 7, 10, 15, 9, 9, 9, 17, 19, 9, 20,
+	10, 5, 10, 10, 10, 13, 15, 9, 9, 9, 18, 9, 17, 17, 20, 10, 10, 10, 5, 13, 7, 10, 15, 9,
+	9, 9, 17, 19, 9, 20, 10, 10, 13, 15, 9, 5, 17, 19, 9, 20, 10, 10, 10, 15, 7, 9, 5, 19,
+	9, 9, 20, 10, 10, 13, 5, 15, 9, 5, 17, 19, 9, 20, 10, 10, 10, 15, 7, 9, 5, 19, 5, 9,
+	9, 20, 10, 10, 10, 5, 15, 7, 9, 5, 19, 9, 9, 20, 10, 10, 10, 5, 15, 7, 9, 5, 19, 5,
+	9, 9, 20, 13, 10, 10, 10, 17, 7, 9, 9, 9, 20, 10, 13, 10, 13, 7, 9, 5, 9, 17, 17, 20,
+	10, 13, 10, 7, 13, 9, 5, 9, 17, 17, 20, 10, 10, 10, 15, 7, 9, 5, 10, 19, 9, 9, 9, 20,
+	10, 10, 10, 7, 15, 7, 9, 5, 9, 19, 9, 20, 10, 13, 10, 7, 10, 7, 13, 9, 9, 9, 17, 17,
+	20, 13, 10, 10, 10, 17, 7, 9, 5, 9, 9, 20, 10, 10, 15, 10, 7, 9, 5, 19, 7, 9, 9, 20,
+	10, 10, 7, 10, 7, 13, 9, 5, 9, 17, 9, 20, 10, 10, 15, 10, 7, 9, 5, 19, 7, 9, 5, 9,
+	20, 10, 10, 10, 7, 15, 7, 9, 5, 9, 5, 19, 9, 20, 10, 10, 10, 7, 15, 7, 9, 5, 9, 5,
+	19, 5, 9, 20, 10, 10, 5, 10, 5, 15, 7, 9, 5, 19, 9, 9, 20, 10, 10, 5, 10, 5, 15, 7,
+	9, 5, 19, 5, 9, 9, 20, 10, 10, 5, 10, 7, 15, 7, 9, 5, 9, 19, 9, 20, 10, 10, 7, 10,
+	7, 10, 7, 13, 9, 9, 9, 17, 9, 20, 10, 10, 5, 10, 7, 15, 7, 9, 5, 9, 5, 19, 9, 20,
+	10, 10, 5, 10, 7, 15, 7, 9, 5, 9, 5, 19, 5, 9, 20, 10, 10, 13, 15, 9, 5, 19, 9, 17,
+	20, 10, 10, 13, 13, 7, 9, 5, 17, 9, 17, 20, 10, 10, 13, 5, 15, 9, 5, 19, 9, 17, 20, 10,
+	10, 10, 15, 7, 9, 5, 19, 7, 9, 9, 20, 10, 10, 10, 7, 15, 7, 9, 5, 19, 9, 9, 20, 10,
+	10, 10, 5, 15, 7, 9, 5, 19, 7, 9, 9, 20, 5, 10, 5, 10, 5, 13, 5, 9, 9, 17, 20, 10,
+	10, 15, 10, 7, 9, 5, 19, 9, 9, 20, 5, 10, 10, 10, 7, 13, 9, 5, 9, 9, 17, 20, 10, 10,
+	13, 15, 5, 9, 5, 10, 17, 19, 9, 9, 20, 10, 10, 13, 7, 10, 7, 9, 7, 17, 9, 9, 20, 5,
+	10, 10, 10, 7, 10, 7, 13, 9, 9, 9, 9, 17, 20, 13, 10, 10, 10, 17, 7, 9, 7, 9, 9, 20,
+	10, 10, 15, 10, 7, 9, 5, 19, 5, 9, 9, 20, 10, 10, 7, 10, 7, 13, 9, 5, 9, 9, 17, 20,
+	10, 13, 10, 13, 7, 10, 14, 9, 9, 17, 19, 9, 20, 10, 10, 10, 7, 15, 7, 13, 9, 9, 19, 9,
+	17, 20, 10, 13, 10, 5, 13, 7, 10, 14, 9, 9, 17, 19, 9, 20, 10, 10, 5, 10, 7, 15, 7, 9,
+	5, 19, 9, 9, 20, 10, 10, 5, 10, 5, 15, 7, 9, 5, 19, 7, 9, 9, 20, 10, 10, 5, 13, 7,
+	10, 7, 9, 7, 17, 9, 9, 20, 10, 10, 7, 10, 7, 10, 7, 13, 9, 9, 9, 9, 17, 20, 10, 10,
+	5, 10, 7, 15, 7, 13, 9, 9, 19, 9, 17, 20, 10, 10, 7, 10, 7, 10, 5, 15, 9, 9, 18, 9,
+	9, 17, 20, 5, 10, 5, 10, 5, 13, 7, 9, 17, 9, 20, 10, 10, 10, 15, 7, 9, 5, 9, 19, 9,
+	20, 10, 10, 13, 7, 13, 9, 5, 9, 17, 17, 20, 5, 10, 10, 13, 10, 7, 13, 9, 9, 9, 17, 17,
+	20, 10, 10, 10, 5, 15, 7, 9, 5, 9, 19, 9, 20, 10, 10, 13, 7, 10, 7, 13, 9, 9, 9, 17,
+	17, 20, 5, 10, 5, 10, 5, 13, 7, 9, 9, 17, 20, 5, 10, 10, 10, 13, 7, 9, 7, 9, 9, 17,
+	20, 5, 10, 10, 10, 7, 13, 9, 7, 9, 9, 17, 20, 10, 10, 13, 13, 7, 10, 14, 9, 17, 9, 19,
+	9, 20, 10, 10, 13, 7, 10, 7, 9, 7, 9, 17, 9, 20, 10, 10, 13, 5, 13, 7, 10, 14, 9, 17,
+	9, 19, 9, 20, 10, 10, 5, 13, 7, 13, 9, 5, 9, 17, 17, 20, 5, 10, 10, 10, 13, 7, 13, 9,
+	9, 9, 17, 17, 20, 10, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 20, 10, 13, 15, 10, 5, 10, 19,
+	9, 7, 17, 9, 9, 20, 10, 10, 15, 15, 10, 10, 19, 9, 19, 9, 9, 9, 20, 10, 10, 15, 15, 5,
+	10, 10, 19, 9, 19, 9, 9, 9, 20, 10, 10, 5, 10, 5, 15, 7, 9, 5, 9, 19, 9, 20, 10, 10,
+	5, 13, 7, 10, 7, 13, 9, 9, 9, 17, 17, 20, 10, 10, 5, 13, 7, 10, 7, 9, 7, 9, 17, 9,
+	20, 10, 13, 10, 10, 15, 10, 14, 9, 9, 19, 19, 9, 9, 20, 10, 10, 5, 15, 15, 10, 10, 19, 9,
+	19, 9, 9, 9, 20, 10, 10, 5, 15, 15, 5, 10, 10, 19, 9, 19, 9, 9, 9, 20, 5, 10, 5, 10,
+	5, 13, 7, 9, 5, 17, 9, 20, 10, 10, 10, 15, 7, 9, 5, 9, 5, 19, 9, 20, 10, 10, 13, 7,
+	10, 15, 9, 9, 19, 9, 17, 20, 10, 10, 10, 15, 7, 9, 5, 9, 5, 19, 5, 9, 20, 10, 10, 10,
+	5, 15, 7, 9, 5, 9, 5, 19, 9, 20, 10, 10, 10, 5, 15, 7, 9, 5, 9, 5, 19, 5, 9, 20,
+	5, 10, 5, 10, 5, 13, 7, 9, 5, 9, 17, 20, 10, 10, 10, 15, 7, 13, 9, 9, 19, 9, 17, 20,
+	10, 10, 13, 7, 10, 15, 9, 9, 17, 19, 9, 20, 10, 10, 13, 13, 7, 10, 14, 9, 9, 17, 19, 9,
+	20, 10, 10, 10, 5, 15, 7, 13, 9, 9, 19, 9, 17, 20, 10, 10, 13, 5, 13, 7, 10, 14, 9, 9,
+	17, 19, 9, 20, 5, 10, 5, 10, 5, 13, 7, 9, 5, 9, 5, 17, 20, 10, 10, 10, 15, 7, 13, 9,
+	9, 18, 9, 17, 17, 20, 10, 5, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 20, 5, 10, 15, 10, 10,
+	7, 19, 5, 13, 9, 9, 9, 17, 20, 5, 10, 15, 10, 15, 10, 10, 19, 19, 9, 9, 9, 9, 20, 10,
+	10, 15, 15, 10, 10, 19, 9, 19, 9, 7, 9, 9, 20, 10, 13, 15, 10, 10, 10, 19, 9, 17, 9, 9,
+	9, 20, 10, 13, 15, 10, 5, 10, 10, 19, 9, 17, 9, 9, 9, 20, 5, 10, 10, 10, 10, 13, 15, 9,
+	9, 9, 19, 9, 17, 20, 5, 10, 10, 10, 10, 5, 13, 15, 9, 9, 9, 19, 9, 17, 20, 13, 10, 15,
+	10, 14, 10, 10, 19, 19, 9, 9, 9, 9, 20, 10, 10, 5, 15, 15, 10, 10, 19, 9, 19, 9, 7, 9,
+	9, 20, 10, 10, 10, 10, 15, 15, 9, 9, 19, 19, 9, 9, 20, 10, 10, 10, 10, 5, 15, 15, 9, 9,
+	19, 19, 9, 9, 20, 10, 10, 13, 10, 13, 15, 9, 9, 19, 9, 17, 17, 20, 10, 10, 10, 10, 7, 15,
+	15, 9, 9, 19, 9, 19, 9, 20, 10, 10, 10, 15, 10, 15, 9, 9, 19, 19, 7, 9, 9, 20, 10, 10,
+	10, 5, 10, 7, 15, 15, 9, 9, 19, 9, 19, 9, 20, 10, 10, 10, 13, 13, 15, 9, 9, 17, 19, 9,
+	17, 20, 10, 10, 10, 10, 7, 15, 15, 9, 9, 19, 19, 9, 9, 20, 10, 10, 10, 15, 10, 15, 9, 9,
+	19, 19, 9, 9, 20, 10, 10, 10, 13, 15, 10, 14, 9, 9, 19, 19, 9, 9, 20, 10, 10, 10, 15, 10,
+	15, 9, 9, 19, 19, 5, 9, 9, 20, 10, 10, 10, 5, 13, 15, 10, 14, 9, 9, 19, 19, 9, 9, 20,
+	10, 10, 10, 10, 15, 15, 9, 9, 19, 9, 19, 9, 20, 10, 10, 10, 10, 5, 15, 15, 9, 9, 19, 9,
+	19, 9, 20, 10, 5, 10, 5, 13, 7, 10, 7, 9, 7, 9, 17, 9, 20, 10, 10, 13, 10, 15, 10, 14,
+	9, 9, 19, 19, 9, 9, 20, 10, 15, 10, 10, 10, 19, 7, 15, 9, 9, 9, 19, 9, 20, 10, 10, 13,
+	5, 10, 15, 10, 14, 9, 9, 19, 19, 9, 9, 20, 10, 5, 13, 15, 10, 10, 10, 19, 9, 17, 9, 9,
+	9, 20, 10, 5, 13, 15, 10, 5, 10, 10, 19, 9, 17, 9, 9, 9, 20, 10, 10, 10, 10, 15, 15, 9,
+	9, 18, 9, 19, 9, 17, 20, 10, 10, 10, 10, 5, 15, 15, 9, 9, 18, 9, 19, 9, 17, 20, 10, 10,
+	10, 10, 13, 15, 9, 13, 9, 9, 19, 9, 17, 17, 20, 10, 15, 10, 10, 7, 10, 19, 7, 15, 9, 9,
+	9, 19, 9, 20, 10, 10, 10, 15, 15, 9, 5, 19, 19, 9, 9, 20, 10, 10, 10, 15, 5, 15, 9, 5,
+	19, 19, 9, 9, 20, 13, 10, 10, 10, 10, 17, 7, 9, 9, 9, 9, 20, 10, 10, 15, 10, 7, 13, 9,
+	5, 9, 17, 19, 9, 20, 13, 10, 10, 10, 10, 17, 7, 9, 5, 9, 9, 9, 20, 10, 10, 13, 7, 10,
+	7, 13, 9, 5, 9, 17, 17, 9, 20, 10, 13, 10, 13, 15, 9, 5, 19, 9, 17, 17, 20, 10, 10, 10,
+	15, 7, 13, 9, 5, 19, 9, 17, 9, 20, 10, 10, 10, 7, 15, 15, 9, 5, 19, 9, 19, 9, 20, 10,
+	10, 10, 15, 7, 9, 5, 10, 5, 19, 9, 9, 9, 20, 13, 10, 10, 10, 10, 17, 7, 9, 7, 9, 9,
+	9, 20, 10, 13, 10, 7, 10, 7, 13, 9, 5, 9, 9, 17, 17, 20, 10, 10, 15, 10, 15, 9, 5, 19,
+	19, 7, 9, 9, 20, 10, 13, 10, 13, 7, 13, 9, 5, 9, 17, 17, 17, 20, 10, 13, 10, 7, 10, 15,
+	9, 5, 9, 19, 9, 17, 20, 10, 13, 10, 6, 10, 7, 13, 9, 7, 9, 9, 17, 17, 20, 10, 10, 10,
+	7, 15, 7, 13, 9, 5, 9, 17, 19, 9, 20, 10, 13, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 17,
+	20, 10, 13, 10, 6, 10, 13, 15, 9, 9, 17, 19, 9, 17, 20, 10, 13, 10, 13, 7, 10, 15, 9, 9,
+	19, 9, 17, 17, 20, 10, 13, 10, 6, 10, 13, 15, 9, 9, 19, 9, 17, 17, 20, 10, 13, 10, 13, 7,
+	10, 15, 9, 9, 17, 19, 9, 17, 20, 10, 10, 5, 10, 7, 15, 7, 13, 9, 5, 9, 17, 19, 9, 20,
+	10, 10, 7, 10, 7, 10, 7, 13, 9, 7, 9, 9, 17, 9, 20, 10, 10, 13, 13, 15, 9, 5, 17, 19,
+	9, 17, 20, 10, 10, 13, 13, 5, 15, 9, 5, 17, 19, 9, 17, 20, 5, 13, 13, 10, 10, 10, 17, 7,
+	9, 9, 17, 9, 20, 10, 10, 15, 10, 7, 13, 9, 5, 9, 19, 9, 17, 20, 5, 13, 13, 10, 10, 10,
+	17, 7, 9, 5, 9, 17, 9, 20, 10, 10, 13, 7, 10, 7, 13, 9, 5, 9, 17, 9, 17, 20, 10, 10,
+	15, 10, 15, 9, 5, 19, 19, 9, 9, 20, 10, 10, 10, 15, 7, 13, 9, 5, 19, 9, 9, 17, 20, 10,
+	10, 13, 15, 9, 5, 10, 5, 17, 19, 9, 9, 20, 10, 10, 10, 15, 7, 9, 5, 10, 7, 19, 9, 9,
+	9, 20, 5, 13, 13, 10, 10, 10, 17, 7, 9, 7, 9, 17, 9, 20, 10, 10, 15, 10, 7, 10, 15, 9,
+	9, 19, 19, 9, 9, 20, 10, 10, 15, 10, 15, 9, 5, 19, 19, 5, 9, 9, 20, 5, 10, 10, 10, 13,
+	7, 13, 9, 5, 9, 17, 9, 17, 20, 10, 13, 10, 7, 10, 15, 9, 5, 9, 17, 19, 9, 20, 10, 13,
+	10, 13, 7, 9, 5, 10, 7, 9, 17, 17, 9, 20, 10, 10, 10, 7, 15, 7, 13, 9, 5, 9, 19, 9,
+	17, 20, 10, 13, 13, 15, 10, 10, 19, 9, 7, 17, 9, 17, 9, 20, 10, 13, 10, 6, 10, 13, 15, 9,
+	9, 17, 17, 19, 9, 20, 10, 13, 15, 10, 10, 10, 19, 9, 7, 9, 9, 17, 9, 20, 10, 13, 10, 6,
+	13, 10, 15, 9, 9, 17, 17, 19, 9, 20, 10, 13, 10, 13, 7, 10, 15, 9, 9, 17, 17, 19, 9, 20,
+	10, 10, 5, 10, 7, 15, 7, 13, 9, 5, 9, 19, 9, 17, 20, 10, 10, 7, 10, 7, 10, 7, 13, 9,
+	7, 9, 9, 9, 17, 20, 10, 10, 10, 15, 15, 9, 5, 19, 9, 19, 9, 20, 10, 10, 10, 15, 5, 15,
+	9, 5, 19, 9, 19, 9, 20, 5, 13, 13, 10, 10, 10, 17, 7, 9, 17, 9, 9, 20, 5, 10, 10, 13,
+	10, 7, 13, 9, 5, 9, 9, 17, 17, 20, 5, 13, 13, 10, 10, 10, 17, 7, 9, 5, 17, 9, 9, 20,
+	10, 10, 13, 7, 10, 7, 13, 9, 5, 9, 9, 17, 17, 20, 5, 10, 10, 13, 10, 15, 9, 5, 17, 9,
+	19, 9, 20, 10, 10, 15, 10, 7, 13, 9, 5, 19, 9, 17, 9, 20, 10, 10, 13, 7, 10, 15, 9, 5,
+	17, 9, 19, 9, 20, 10, 10, 13, 13, 7, 9, 5, 10, 7, 17, 9, 17, 9, 20, 5, 13, 13, 10, 10,
+	10, 17, 7, 9, 7, 17, 9, 9, 20, 5, 10, 10, 13, 10, 7, 10, 15, 9, 9, 17, 9, 19, 9, 20,
+	10, 13, 15, 10, 10, 18, 9, 5, 17, 17, 9, 9, 20, 5, 10, 10, 10, 13, 7, 13, 9, 5, 9, 9,
+	17, 17, 20, 10, 13, 15, 10, 10, 18, 9, 7, 17, 17, 9, 9, 20, 10, 10, 15, 10, 7, 9, 5, 10,
+	7, 19, 9, 9, 9, 20, 10, 10, 15, 15, 10, 10, 18, 9, 17, 19, 9, 9, 9, 20, 10, 10, 15, 15,
+	10, 10, 19, 9, 7, 19, 9, 9, 9, 20, 10, 13, 15, 10, 10, 10, 18, 9, 17, 9, 17, 9, 9, 20,
+	10, 13, 15, 10, 10, 10, 19, 9, 7, 9, 17, 9, 9, 20, 10, 13, 15, 10, 10, 18, 9, 5, 17, 7,
+	17, 9, 9, 20, 5, 10, 10, 10, 13, 7, 10, 15, 9, 9, 17, 9, 19, 9, 20, 10, 10, 5, 15, 15,
+	10, 10, 18, 9, 17, 19, 9, 9, 9, 20, 10, 10, 5, 15, 15, 10, 10, 19, 9, 7, 19, 9, 9, 9,
+	20, 5, 10, 10, 10, 13, 15, 9, 5, 9, 17, 19, 9, 20, 10, 10, 10, 15, 7, 13, 9, 5, 9, 17,
+	19, 9, 20, 5, 13, 13, 10, 10, 10, 17, 7, 17, 9, 9, 9, 20, 5, 10, 10, 13, 10, 7, 13, 9,
+	7, 9, 9, 17, 17, 20, 10, 10, 10, 5, 15, 7, 13, 9, 5, 9, 17, 19, 9, 20, 10, 10, 13, 7,
+	10, 7, 13, 9, 7, 9, 9, 17, 17, 20, 5, 10, 10, 10, 13, 15, 9, 5, 9, 19, 9, 17, 20, 10,
+	10, 10, 15, 7, 13, 9, 5, 9, 19, 9, 17, 20, 10, 10, 13, 7, 10, 15, 9, 5, 9, 17, 19, 9,
+	20, 10, 10, 10, 15, 7, 9, 5, 10, 7, 9, 19, 9, 9, 20, 10, 10, 10, 5, 15, 7, 13, 9, 5,
+	9, 19, 9, 17, 20, 5, 10, 10, 13, 10, 7, 10, 15, 9, 9, 9, 17, 19, 9, 20, 13, 10, 10, 10,
+	17, 5, 15, 7, 9, 9, 19, 9, 20, 5, 10, 10, 10, 13, 7, 13, 9, 7, 9, 9, 17, 17, 20, 5,
+	10, 10, 10, 7, 10, 15, 9, 7, 9, 9, 19, 9, 20, 5, 10, 10, 10, 13, 7, 10, 14, 9, 7, 9,
+	9, 19, 9, 20, 10, 10, 15, 15, 10, 10, 18, 9, 19, 9, 17, 9, 9, 20, 5, 13, 13, 10, 15, 10,
+	10, 17, 17, 7, 19, 9, 9, 9, 20, 10, 13, 15, 10, 10, 10, 18, 9, 17, 17, 9, 9, 9, 20, 10,
+	13, 15, 10, 10, 10, 19, 9, 7, 17, 9, 9, 9, 20, 5, 10, 5, 10, 10, 10, 13, 15, 9, 9, 9,
+	19, 9, 17, 20, 5, 10, 10, 10, 13, 7, 10, 15, 9, 9, 9, 17, 19, 9, 20, 10, 10, 5, 15, 15,
+	10, 10, 18, 9, 19, 9, 17, 9, 9, 20, 5, 10, 10, 10, 5, 13, 7, 10, 15, 9, 9, 9, 17, 19,
+	9, 20, 5, 10, 10, 10, 10, 15, 15, 9, 9, 19, 19, 9, 9, 20, 10, 10, 10, 15, 7, 10, 15, 9,
+	9, 19, 9, 19, 9, 20, 5, 10, 10, 13, 10, 13, 15, 9, 9, 19, 9, 17, 17, 20, 10, 10, 13, 13,
+	7, 10, 15, 9, 9, 17, 19, 9, 17, 20, 5, 10, 10, 10, 15, 10, 15, 9, 9, 19, 19, 7, 9, 9,
+	20, 10, 10, 10, 15, 7, 10, 15, 9, 9, 19, 19, 7, 9, 9, 20, 5, 10, 10, 10, 13, 13, 15, 9,
+	9, 17, 19, 9, 17, 20, 10, 10, 10, 15, 7, 13, 9, 5, 9, 5, 19, 9, 17, 20, 5, 10, 10, 10,
+	15, 10, 15, 9, 9, 19, 19, 9, 9, 20, 10, 10, 10, 15, 7, 10, 15, 9, 9, 19, 19, 9, 9, 20,
+	5, 10, 10, 10, 15, 10, 15, 9, 9, 19, 19, 5, 9, 9, 20, 10, 10, 10, 5, 15, 7, 10, 15, 9,
+	9, 19, 19, 9, 9, 20, 5, 10, 10, 10, 10, 15, 15, 9, 9, 19, 9, 19, 9, 20, 10, 10, 10, 15,
+	7, 13, 13, 9, 9, 19, 9, 17, 17, 20, 10, 10, 7, 10, 15, 10, 15, 9, 9, 19, 19, 9, 9, 20,
+	5, 10, 10, 13, 10, 15, 10, 14, 9, 9, 19, 19, 9, 9, 20, 5, 10, 15, 10, 10, 10, 19, 7, 15,
+	9, 9, 9, 19, 9, 20, 10, 10, 13, 7, 10, 15, 10, 14, 9, 9, 19, 19, 9, 9, 20, 5, 10, 5,
+	13, 15, 10, 10, 10, 19, 9, 17, 9, 9, 9, 20, 10, 5, 13, 15, 10, 10, 10, 19, 9, 7, 17, 9,
+	9, 9, 20, 5, 10, 10, 10, 10, 15, 15, 9, 9, 18, 9, 19, 9, 17, 20, 5, 10, 10, 10, 10, 5,
+	15, 15, 9, 9, 18, 9, 19, 9, 17, 20, 10, 15, 10, 10, 10, 19, 7, 15, 9, 7, 9, 9, 19, 9,
+	20, 5, 10, 15, 10, 10, 7, 10, 19, 7, 15, 9, 9, 9, 19, 9, 20, 17, 10, 17, 10, 17, 10, 17,
+	10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 10, 17, 17, 9, 9, 9, 9, 20,
+	17, 10, 17, 10, 17, 10, 17, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17,
+	5, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 5, 9, 9, 9, 20, 17, 10, 17, 10,
+	17, 10, 17, 17, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 10, 17, 17, 7, 9, 9, 9, 9,
+	20, 17, 10, 17, 10, 17, 17, 10, 10, 17, 17, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17,
+	10, 17, 7, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 5, 9, 17, 9, 9, 20, 17, 10,
+	17, 10, 17, 10, 17, 17, 17, 5, 9, 5, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 9, 17, 9,
+	9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17,
+	10, 17, 5, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 10, 17, 7, 9, 9, 9, 9, 20,
+	17, 10, 17, 10, 17, 17, 10, 17, 5, 9, 17, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 17, 5,
+	9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 17, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17,
+	5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17,
+	17, 10, 17, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5, 17, 9, 9, 20, 17, 10, 17, 10,
+	17, 17, 17, 17, 5, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 17, 9, 9, 20, 17, 10, 17, 17, 10,
+	10, 17, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 5, 17, 7, 9, 9,
+	9, 20, 17, 10, 17, 17, 10, 10, 17, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10,
+	17, 17, 7, 17, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 7, 9, 9, 9, 20, 17, 10,
+	17, 17, 10, 10, 17, 17, 17, 9, 9, 9, 20, 17, 10, 17, 17, 17, 10, 10, 10, 17, 17, 7, 9, 9,
+	9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 5, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10,
+	17, 17, 10, 17, 7, 9, 6, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 5, 9, 9, 17, 9,
+	20, 17, 10, 17, 10, 17, 17, 5, 17, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17,
+	9, 9, 17, 9, 20, 17, 10, 17, 10, 14, 17, 17, 10, 17, 10, 19, 7, 9, 9, 9, 9, 20, 17, 10,
+	17, 10, 17, 17, 10, 17, 7, 17, 9, 9, 9, 20, 17, 10, 17, 10, 14, 17, 17, 17, 10, 10, 19, 7,
+	9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 5, 9, 9, 17, 9, 20, 17, 10, 17, 10, 17,
+	17, 5, 17, 17, 5, 9, 5, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 9, 17, 9, 20, 17, 10, 17,
+	10, 17, 17, 10, 17, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 14, 17, 17, 10, 17, 19, 9, 9, 9,
+	20, 17, 10, 17, 10, 17, 17, 17, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5, 9,
+	17, 9, 20, 17, 10, 17, 10, 17, 17, 17, 17, 5, 9, 5, 9, 20, 17, 10, 17, 10, 17, 17, 17, 9,
+	17, 9, 20, 17, 10, 17, 17, 10, 10, 17, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10,
+	17, 10, 10, 17, 17, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10, 10, 17, 17, 10, 17, 7, 9, 9, 9,
+	9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 7, 9, 17, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17,
+	17, 7, 9, 5, 9, 9, 20, 17, 10, 17, 17, 10, 10, 17, 17, 9, 17, 9, 9, 20, 17, 10, 17, 17,
+	17, 10, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 5, 17, 7, 9,
+	9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 5, 13, 7, 9, 9, 17, 9, 20, 17, 10, 17, 10,
+	17, 10, 17, 17, 7, 9, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 10, 17, 7, 9, 9, 9,
+	20, 17, 10, 17, 17, 10, 10, 17, 17, 9, 9, 17, 9, 20, 17, 10, 17, 10, 14, 17, 17, 10, 17, 10,
+	19, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 7, 9, 17, 9, 9, 20, 17, 10, 17,
+	10, 14, 17, 17, 17, 10, 10, 19, 5, 9, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 7, 9,
+	9, 17, 9, 20, 17, 10, 17, 10, 17, 17, 5, 9, 17, 17, 5, 9, 20, 17, 10, 17, 10, 17, 17, 5,
+	9, 17, 17, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 7, 9, 5, 9, 9, 20, 17, 10, 17, 17,
+	5, 17, 10, 17, 5, 17, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 10, 17, 7, 9, 5, 9, 9, 20,
+	17, 10, 17, 10, 17, 17, 17, 5, 9, 5, 17, 9, 20, 17, 10, 17, 10, 17, 17, 9, 17, 17, 5, 9,
+	20, 17, 10, 17, 10, 17, 17, 9, 17, 17, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 10, 17, 5, 9,
+	9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 5, 17, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17,
+	10, 17, 10, 17, 7, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 5, 9, 17, 9, 9, 20,
+	17, 10, 17, 17, 10, 17, 5, 17, 17, 5, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 17, 9, 9,
+	20, 17, 10, 17, 17, 17, 10, 10, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10,
+	17, 7, 17, 9, 9, 9, 20, 17, 10, 17, 17, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 9, 20, 17,
+	10, 17, 17, 10, 17, 10, 17, 5, 9, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 17, 5, 9,
+	5, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 9, 17, 9, 20, 17, 10, 17, 17, 17, 10, 10, 17, 10,
+	17, 7, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 7, 9, 17, 9, 9, 20, 17, 10, 17,
+	17, 17, 17, 10, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 7, 9, 9,
+	17, 9, 20, 17, 10, 17, 17, 10, 17, 5, 9, 17, 17, 5, 9, 20, 17, 10, 17, 17, 10, 17, 5, 9,
+	17, 17, 9, 20, 17, 10, 17, 17, 5, 17, 10, 17, 17, 5, 9, 9, 20, 17, 10, 17, 17, 5, 17, 10,
+	17, 17, 9, 9, 20, 17, 10, 17, 17, 5, 17, 17, 10, 17, 5, 9, 9, 20, 17, 10, 17, 17, 5, 17,
+	17, 5, 17, 9, 20, 17, 10, 17, 17, 5, 17, 17, 17, 5, 9, 20, 17, 10, 17, 17, 5, 17, 17, 17,
+	9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 17, 5, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17,
+	17, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 10, 17, 5, 9, 9, 9, 20, 17, 10, 17, 17, 10,
+	17, 17, 5, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 17, 5, 9, 9, 20, 17, 10, 17, 17, 10,
+	17, 17, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 17, 7, 9, 9, 9, 20, 17, 10, 17, 17,
+	17, 10, 10, 17, 17, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 10, 17, 7, 9, 9, 9, 20, 17,
+	10, 17, 17, 10, 17, 17, 5, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17, 17, 17, 5, 9, 5, 9, 20,
+	17, 10, 17, 17, 10, 17, 17, 9, 17, 9, 20, 17, 10, 17, 17, 17, 10, 17, 10, 17, 5, 9, 9, 9,
+	20, 17, 10, 17, 17, 17, 10, 17, 5, 17, 9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 10, 17, 7, 9,
+	9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 5, 9, 17, 9, 20, 17, 10, 17, 17, 17, 5, 17, 17, 5,
+	9, 20, 17, 10, 17, 17, 17, 5, 17, 17, 9, 20, 17, 10, 17, 17, 17, 10, 17, 17, 5, 9, 9, 20,
+	17, 10, 17, 17, 17, 10, 17, 17, 9, 9, 20, 17, 10, 17, 17, 17, 17, 10, 17, 5, 9, 9, 20, 17,
+	10, 17, 17, 17, 17, 5, 17, 9, 20, 17, 10, 17, 17, 17, 17, 17, 5, 9, 20, 17, 10, 17, 17, 17,
+	17, 17, 9, 20, 17, 17, 10, 10, 17, 10, 17, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 17, 10, 10,
+	17, 10, 17, 10, 17, 17, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 10, 17, 5, 9, 9,
+	9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 5, 17, 9, 9, 9, 20, 17, 17, 10, 10, 17, 10, 17,
+	17, 17, 5, 9, 9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 17, 9, 9, 9, 20, 17, 17, 10, 10,
+	17, 10, 17, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 10, 17, 17, 9, 9,
+	9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17,
+	10, 17, 17, 5, 9, 17, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 5, 9, 7, 9, 9, 20,
+	17, 10, 17, 10, 17, 17, 5, 17, 7, 17, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 10, 17, 5,
+	9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 5, 17, 9, 9, 9, 20, 17, 17, 10, 10, 17,
+	17, 10, 17, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 5, 9, 17, 9, 9,
+	20, 17, 10, 17, 10, 17, 17, 5, 17, 17, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 7, 17, 17, 9,
+	9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 17, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5,
+	17, 7, 9, 9, 20, 17, 17, 10, 10, 17, 17, 17, 10, 17, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17,
+	17, 17, 7, 17, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 17, 7, 9, 9, 20, 17, 17, 10, 10, 17,
+	17, 17, 17, 9, 9, 20, 17, 10, 14, 17, 17, 10, 19, 10, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17,
+	17, 17, 10, 10, 10, 17, 17, 5, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 7,
+	15, 7, 19, 9, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 7, 17, 9, 9, 9, 20, 17, 17, 17,
+	10, 10, 10, 17, 17, 17, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 6, 10, 17, 17, 17, 9, 9, 9,
+	20, 17, 10, 17, 17, 17, 10, 6, 10, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17, 10, 14, 17, 10, 17,
+	17, 10, 17, 7, 19, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 5, 13, 5, 9, 9,
+	9, 17, 20, 17, 10, 17, 10, 17, 10, 17, 17, 5, 9, 9, 9, 17, 20, 17, 10, 14, 17, 10, 17, 17,
+	17, 10, 7, 19, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 9, 9, 9, 17, 20, 17, 10,
+	17, 10, 17, 17, 10, 17, 17, 7, 15, 7, 19, 9, 9, 9, 20, 17, 10, 17, 10, 14, 17, 17, 10, 17,
+	7, 19, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 5, 13, 5, 9, 9, 9, 17, 20, 17,
+	10, 17, 10, 17, 17, 10, 17, 5, 9, 9, 9, 17, 20, 17, 10, 17, 10, 14, 17, 17, 17, 10, 7, 19,
+	9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 10, 17,
+	17, 7, 9, 6, 9, 9, 20, 17, 10, 17, 17, 5, 17, 10, 17, 5, 17, 7, 9, 9, 20, 17, 10, 17,
+	10, 17, 17, 17, 10, 17, 7, 9, 6, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5, 9, 9, 17, 20,
+	17, 10, 17, 10, 17, 17, 9, 17, 10, 17, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 9, 9, 17,
+	20, 17, 10, 14, 17, 17, 10, 19, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10,
+	17, 10, 17, 5, 19, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 6, 10, 17, 17, 10, 17, 7, 9, 9,
+	9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 7, 9, 17, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17,
+	17, 17, 7, 9, 7, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 7, 17, 9, 9, 20, 17, 10, 17,
+	17, 17, 10, 6, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 17, 7,
+	19, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 5, 13, 7, 9, 9, 9, 17, 20, 17,
+	10, 17, 10, 17, 10, 17, 17, 7, 9, 9, 9, 17, 20, 17, 10, 14, 17, 17, 10, 17, 17, 10, 7, 19,
+	7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 10, 17, 17, 9, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17,
+	17, 10, 17, 5, 13, 7, 9, 9, 9, 17, 20, 17, 10, 14, 17, 10, 17, 17, 10, 17, 7, 9, 19, 9,
+	9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 5, 13, 7, 9, 9, 9, 17, 20, 17, 10, 17, 10, 17,
+	17, 10, 17, 7, 9, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 5, 9, 17, 17, 5, 9, 5, 20, 17,
+	10, 17, 10, 17, 17, 5, 9, 17, 9, 17, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 7, 9, 7, 9,
+	9, 20, 17, 10, 17, 17, 5, 17, 10, 17, 7, 17, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 10, 17,
+	7, 9, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5, 9, 5, 9, 17, 20, 17, 10, 17, 10, 17,
+	17, 9, 17, 17, 5, 9, 5, 20, 17, 10, 17, 10, 17, 17, 9, 17, 9, 17, 20, 17, 10, 14, 17, 17,
+	10, 17, 19, 10, 10, 17, 7, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 19, 7, 17, 9,
+	9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 19, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 10, 14, 17,
+	17, 10, 17, 10, 17, 5, 9, 19, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 17, 7, 9, 9, 20,
+	17, 10, 17, 17, 10, 17, 7, 17, 17, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 19, 10, 10, 17, 7,
+	9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 19, 7, 17, 9, 9, 9, 20, 17, 10, 17, 17,
+	10, 17, 10, 17, 17, 5, 13, 5, 9, 9, 9, 17, 20, 17, 10, 17, 17, 10, 17, 10, 17, 5, 9, 9,
+	9, 17, 20, 17, 10, 17, 17, 10, 14, 17, 17, 10, 7, 19, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17,
+	5, 17, 9, 9, 17, 20, 17, 10, 14, 17, 17, 17, 10, 19, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17,
+	10, 14, 17, 17, 10, 17, 10, 17, 7, 9, 19, 9, 9, 20, 17, 10, 17, 17, 10, 17, 10, 17, 17, 5,
+	13, 7, 9, 9, 9, 17, 20, 17, 10, 17, 17, 10, 17, 10, 17, 7, 9, 9, 9, 17, 20, 17, 10, 17,
+	17, 10, 17, 5, 9, 17, 17, 5, 9, 5, 20, 17, 10, 17, 17, 10, 17, 5, 9, 17, 9, 17, 20, 17,
+	10, 17, 17, 5, 17, 10, 17, 17, 7, 9, 9, 20, 17, 10, 17, 17, 17, 10, 7, 17, 17, 9, 9, 20,
+	17, 10, 17, 17, 5, 17, 17, 10, 17, 7, 9, 9, 20, 17, 10, 17, 17, 5, 17, 17, 5, 9, 17, 20,
+	17, 10, 17, 17, 5, 17, 17, 17, 5, 9, 5, 20, 17, 10, 17, 17, 5, 17, 17, 9, 17, 20, 17, 10,
+	14, 17, 17, 10, 17, 10, 17, 19, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 5, 17, 7, 9,
+	9, 20, 17, 10, 14, 17, 17, 10, 17, 17, 10, 19, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17,
+	7, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 17, 7, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17,
+	17, 19, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 17, 19, 7, 9, 9, 9, 20, 17, 10, 17, 17,
+	17, 10, 17, 5, 17, 7, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 10, 17, 7, 9, 6, 9, 9, 20,
+	17, 10, 17, 17, 10, 17, 17, 5, 9, 9, 17, 20, 17, 10, 17, 17, 17, 5, 17, 10, 17, 7, 9, 9,
+	20, 17, 10, 17, 17, 10, 17, 17, 9, 9, 17, 20, 17, 10, 14, 17, 17, 17, 10, 17, 10, 19, 7, 9,
+	9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 7, 17, 9, 9, 20, 17, 10, 14, 17, 17, 17, 17, 10, 10,
+	19, 7, 9, 9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 5, 9, 9, 17, 20, 17, 10, 17, 17, 17, 5,
+	17, 17, 5, 9, 5, 20, 17, 10, 17, 17, 17, 5, 17, 9, 17, 20, 17, 10, 17, 17, 17, 10, 17, 17,
+	7, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 17, 19, 9, 9, 20, 17, 10, 17, 17, 17, 17, 10, 17,
+	7, 9, 9, 20, 17, 10, 17, 17, 17, 17, 5, 9, 17, 20, 17, 10, 17, 17, 17, 17, 17, 5, 9, 5,
+	20, 17, 10, 17, 17, 17, 17, 9, 17, 20, 17, 17, 10, 17, 10, 10, 17, 10, 17, 17, 5, 9, 9, 9,
+	9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 5, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 10, 17,
+	17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 7, 17, 9, 9, 9, 20, 17,
+	17, 10, 10, 17, 10, 17, 17, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 10, 17, 17, 17, 9, 9,
+	9, 20, 17, 17, 10, 17, 17, 10, 10, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17,
+	10, 17, 5, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 7, 15, 5, 9, 9, 19,
+	9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 5, 9, 9, 17, 9, 20, 17, 10, 17, 10, 17, 17, 7, 17,
+	10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 7, 9, 17, 9, 20, 17, 10, 14, 17,
+	10, 17, 17, 10, 17, 10, 19, 7, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 7, 17, 9,
+	9, 9, 20, 17, 10, 14, 17, 10, 17, 17, 17, 10, 10, 19, 7, 9, 9, 9, 9, 20, 17, 17, 10, 10,
+	17, 17, 10, 17, 5, 9, 9, 17, 9, 20, 17, 10, 17, 10, 17, 17, 5, 17, 17, 7, 9, 5, 9, 20,
+	17, 10, 17, 10, 17, 17, 7, 17, 9, 17, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 17, 7, 9, 9,
+	9, 20, 17, 10, 14, 17, 10, 17, 17, 10, 17, 19, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 17, 10,
+	17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 7, 9, 17, 9, 20, 17, 10, 17, 10, 17, 17,
+	17, 17, 7, 9, 5, 9, 20, 17, 17, 10, 10, 17, 17, 17, 9, 17, 9, 20, 17, 17, 17, 10, 10, 10,
+	17, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 10, 17, 17, 9, 9, 9, 9,
+	20, 17, 17, 17, 10, 10, 10, 17, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17,
+	17, 5, 17, 9, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 17, 5, 9, 9, 9, 20, 17, 17, 17,
+	10, 10, 10, 17, 17, 17, 9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 6, 10, 10, 17, 17, 7, 9, 9,
+	9, 9, 20, 17, 10, 14, 17, 10, 17, 17, 10, 17, 7, 19, 5, 9, 9, 9, 20, 17, 17, 10, 10, 17,
+	10, 17, 17, 17, 5, 13, 5, 9, 9, 9, 17, 20, 17, 17, 10, 10, 17, 10, 17, 17, 5, 9, 9, 9,
+	17, 20, 17, 10, 14, 17, 10, 17, 17, 17, 10, 7, 19, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17,
+	5, 17, 7, 9, 9, 17, 20, 17, 17, 10, 10, 17, 17, 10, 17, 17, 7, 15, 7, 19, 9, 9, 9, 20,
+	17, 10, 14, 17, 10, 17, 17, 10, 17, 7, 19, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 17,
+	5, 13, 5, 9, 9, 9, 17, 20, 17, 17, 10, 10, 17, 17, 10, 17, 5, 9, 9, 9, 17, 20, 17, 10,
+	14, 17, 10, 17, 17, 17, 10, 7, 19, 9, 9, 9, 20, 17, 10, 17, 10, 17, 17, 7, 17, 9, 9, 17,
+	20, 17, 10, 17, 17, 17, 10, 7, 10, 17, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 5, 17, 10, 17,
+	5, 17, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 17, 5, 13, 7, 9, 9, 17, 20, 17, 10, 17,
+	10, 17, 17, 17, 7, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 17, 17, 7, 9, 5, 9, 5, 20, 17,
+	17, 10, 10, 17, 17, 17, 9, 9, 17, 20, 17, 17, 17, 10, 17, 10, 10, 10, 17, 17, 7, 9, 9, 9,
+	9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 17, 5, 19, 5, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10,
+	17, 17, 17, 5, 15, 5, 9, 9, 19, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 7, 9, 9, 17, 9,
+	20, 17, 10, 17, 17, 10, 17, 7, 17, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17,
+	7, 9, 17, 9, 20, 17, 17, 17, 17, 10, 10, 10, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17, 10, 14,
+	17, 17, 10, 17, 10, 17, 7, 19, 5, 9, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 17, 5, 13,
+	7, 9, 9, 9, 17, 20, 17, 17, 17, 10, 10, 10, 17, 17, 7, 9, 9, 9, 17, 20, 17, 10, 14, 17,
+	17, 10, 17, 17, 10, 7, 19, 5, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 5, 17, 7, 9, 9, 17,
+	20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 5, 15, 5, 9, 9, 19, 9, 20, 17, 10, 17, 10, 17, 17,
+	10, 14, 17, 5, 9, 9, 19, 9, 20, 17, 10, 17, 10, 17, 17, 17, 10, 17, 5, 15, 5, 9, 9, 19,
+	9, 20, 17, 10, 17, 10, 17, 17, 10, 17, 7, 9, 6, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 5,
+	9, 9, 17, 17, 5, 20, 17, 10, 17, 10, 17, 17, 5, 9, 9, 17, 17, 20, 17, 10, 17, 17, 17, 10,
+	7, 17, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 17, 5, 17, 10, 17, 7, 9, 17, 9, 20, 17, 10,
+	14, 17, 17, 5, 17, 17, 10, 10, 19, 5, 9, 9, 9, 20, 17, 10, 17, 17, 5, 17, 10, 17, 7, 9,
+	9, 17, 20, 17, 10, 17, 10, 17, 17, 9, 9, 17, 17, 5, 20, 17, 10, 17, 10, 17, 17, 9, 9, 17,
+	17, 20, 17, 10, 14, 17, 17, 10, 17, 10, 17, 10, 19, 7, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17,
+	10, 17, 10, 17, 5, 19, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 17, 10, 10, 19, 7, 9, 9,
+	9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 19, 7, 9, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17,
+	5, 17, 17, 7, 9, 5, 9, 20, 17, 10, 17, 17, 10, 17, 7, 17, 9, 17, 9, 20, 17, 10, 14, 17,
+	17, 17, 10, 10, 17, 10, 19, 7, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 17, 7, 19,
+	9, 9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 10, 17, 5, 15, 5, 9, 9, 19, 9, 20, 17, 10, 14,
+	17, 17, 10, 17, 10, 19, 7, 9, 9, 9, 17, 20, 17, 10, 14, 17, 17, 10, 17, 17, 10, 7, 19, 9,
+	9, 9, 20, 17, 10, 17, 17, 10, 17, 7, 17, 9, 9, 17, 20, 17, 10, 14, 17, 17, 17, 10, 17, 10,
+	10, 19, 7, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 19, 7, 9, 9, 17, 9, 20, 17,
+	10, 14, 17, 17, 17, 17, 10, 10, 10, 19, 7, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10,
+	19, 7, 9, 9, 9, 17, 20, 17, 10, 17, 17, 10, 17, 5, 9, 9, 17, 17, 5, 20, 17, 10, 17, 17,
+	10, 17, 5, 9, 9, 17, 17, 20, 17, 10, 17, 17, 5, 17, 10, 17, 17, 7, 9, 5, 9, 20, 17, 10,
+	17, 17, 17, 10, 7, 17, 9, 17, 9, 20, 17, 10, 17, 17, 5, 17, 17, 10, 17, 7, 9, 5, 9, 20,
+	17, 10, 17, 17, 5, 17, 17, 5, 9, 5, 17, 20, 17, 10, 17, 17, 5, 17, 9, 17, 17, 5, 20, 17,
+	10, 17, 17, 5, 17, 9, 17, 17, 20, 17, 10, 14, 17, 17, 10, 17, 10, 17, 19, 5, 9, 9, 9, 20,
+	17, 10, 14, 17, 17, 10, 17, 10, 17, 19, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 17, 10, 19,
+	5, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 7, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17, 17,
+	17, 7, 9, 5, 9, 20, 17, 10, 14, 17, 17, 10, 17, 19, 9, 17, 9, 20, 17, 10, 14, 17, 17, 17,
+	10, 10, 17, 19, 5, 9, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 17, 19, 9, 9, 9, 20, 17,
+	10, 17, 17, 10, 17, 17, 17, 5, 13, 7, 9, 9, 17, 20, 17, 10, 17, 17, 10, 17, 17, 7, 9, 9,
+	17, 20, 17, 10, 17, 17, 10, 17, 17, 17, 7, 9, 5, 9, 5, 20, 17, 10, 14, 17, 17, 10, 17, 19,
+	9, 9, 17, 20, 17, 10, 14, 17, 17, 17, 10, 17, 10, 19, 5, 9, 9, 9, 20, 17, 10, 17, 17, 17,
+	10, 17, 7, 9, 17, 9, 20, 17, 10, 14, 17, 17, 17, 17, 10, 10, 19, 5, 9, 9, 9, 20, 17, 10,
+	17, 17, 17, 10, 17, 7, 9, 9, 17, 20, 17, 10, 17, 17, 17, 5, 9, 17, 17, 5, 20, 17, 10, 17,
+	17, 17, 5, 9, 17, 17, 20, 17, 10, 17, 17, 17, 10, 17, 17, 7, 9, 5, 9, 20, 17, 10, 14, 17,
+	17, 17, 10, 19, 9, 17, 9, 20, 17, 10, 17, 17, 17, 17, 10, 17, 7, 9, 5, 9, 20, 17, 10, 17,
+	17, 17, 17, 5, 9, 5, 17, 20, 17, 10, 17, 17, 17, 9, 17, 17, 5, 20, 17, 10, 17, 17, 17, 9,
+	17, 17, 20, 17, 17, 10, 17, 10, 10, 17, 10, 17, 17, 7, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10,
+	17, 10, 10, 17, 17, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10, 10, 17, 17, 10, 17, 7, 9, 9, 9,
+	9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 7, 9, 17, 9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17,
+	17, 7, 9, 5, 9, 9, 20, 17, 17, 10, 17, 10, 10, 17, 17, 9, 17, 9, 9, 20, 17, 17, 10, 17,
+	17, 10, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 5, 17, 7, 9,
+	9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 7, 15, 7, 9, 9, 19, 9, 20, 17, 17, 10, 10,
+	17, 10, 17, 17, 7, 9, 9, 17, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 10, 17, 7, 9, 9, 9,
+	20, 17, 17, 10, 17, 10, 10, 17, 17, 9, 9, 17, 9, 20, 17, 10, 14, 17, 10, 17, 17, 10, 17, 10,
+	19, 5, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 7, 9, 17, 9, 9, 20, 17, 10, 14,
+	17, 10, 17, 17, 17, 10, 10, 19, 5, 9, 9, 9, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 7, 9,
+	9, 17, 9, 20, 17, 10, 17, 10, 17, 17, 7, 9, 17, 17, 5, 9, 20, 17, 10, 17, 10, 17, 17, 7,
+	9, 17, 17, 9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 17, 7, 9, 5, 9, 9, 20, 17, 17, 10, 17,
+	5, 17, 10, 17, 5, 17, 9, 9, 20, 17, 17, 10, 10, 17, 17, 17, 10, 17, 7, 9, 5, 9, 9, 20,
+	17, 10, 17, 10, 17, 17, 17, 7, 9, 5, 17, 9, 20, 17, 17, 10, 10, 17, 17, 9, 17, 17, 5, 9,
+	20, 17, 17, 10, 10, 17, 17, 9, 17, 17, 9, 20, 17, 17, 17, 10, 10, 10, 17, 10, 17, 17, 7, 9,
+	9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 10, 17, 17, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10,
+	10, 17, 17, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 5, 9, 17, 9, 9,
+	20, 17, 17, 10, 10, 17, 10, 17, 17, 17, 7, 9, 7, 9, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17,
+	7, 17, 9, 9, 20, 17, 17, 10, 17, 17, 10, 6, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 17,
+	17, 17, 10, 10, 10, 17, 5, 17, 7, 9, 9, 9, 20, 17, 17, 10, 10, 17, 10, 17, 17, 17, 5, 13,
+	7, 9, 9, 9, 17, 20, 17, 17, 10, 10, 17, 10, 17, 17, 7, 9, 9, 9, 17, 20, 17, 10, 17, 10,
+	17, 17, 7, 17, 10, 17, 7, 9, 7, 9, 9, 20, 17, 17, 10, 17, 10, 10, 17, 17, 9, 9, 9, 17,
+	20, 17, 10, 17, 10, 17, 17, 10, 17, 17, 7, 15, 7, 9, 19, 9, 9, 20, 17, 10, 17, 10, 14, 17,
+	17, 10, 17, 7, 9, 19, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 10, 17, 7, 15, 7, 9, 19, 9,
+	9, 20, 17, 17, 10, 10, 17, 17, 10, 17, 7, 9, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 7, 9,
+	17, 17, 5, 9, 5, 20, 17, 10, 17, 10, 17, 17, 7, 9, 17, 9, 17, 20, 17, 17, 10, 10, 17, 17,
+	10, 17, 17, 7, 9, 7, 9, 9, 20, 17, 17, 10, 17, 5, 17, 10, 17, 7, 17, 9, 9, 20, 17, 17,
+	10, 10, 17, 17, 17, 10, 17, 7, 9, 7, 9, 9, 20, 17, 10, 17, 10, 17, 17, 17, 7, 9, 5, 9,
+	17, 20, 17, 17, 10, 10, 17, 17, 9, 17, 17, 5, 9, 5, 20, 17, 17, 10, 10, 17, 17, 9, 17, 9,
+	17, 20, 17, 17, 17, 10, 17, 10, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 17,
+	10, 17, 5, 17, 7, 9, 9, 9, 20, 17, 10, 17, 10, 17, 10, 17, 17, 17, 5, 15, 7, 9, 9, 19,
+	9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 5, 9, 9, 17, 9, 20, 17, 17, 10, 17, 10, 17, 7, 17,
+	10, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 7, 9, 17, 9, 20, 17, 17, 17, 17,
+	10, 10, 10, 10, 17, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10, 10, 17, 17, 9, 9,
+	9, 9, 20, 17, 17, 17, 10, 10, 10, 17, 17, 17, 5, 13, 5, 9, 9, 9, 17, 20, 17, 17, 17, 10,
+	10, 10, 17, 17, 5, 9, 9, 9, 17, 20, 17, 10, 17, 17, 10, 17, 7, 17, 10, 17, 7, 9, 7, 9,
+	9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 7, 9, 9, 17, 20, 17, 10, 17, 10, 17, 17, 10, 17, 17,
+	5, 15, 7, 9, 9, 19, 9, 20, 17, 10, 17, 10, 17, 17, 10, 14, 17, 7, 9, 9, 19, 9, 20, 17,
+	10, 17, 10, 17, 17, 17, 10, 17, 5, 15, 7, 9, 9, 19, 9, 20, 17, 10, 17, 10, 17, 17, 17, 5,
+	13, 7, 9, 9, 17, 17, 20, 17, 10, 17, 10, 17, 17, 7, 9, 9, 17, 17, 5, 20, 17, 10, 17, 10,
+	17, 17, 7, 9, 9, 17, 17, 20, 17, 17, 10, 17, 17, 10, 7, 17, 10, 17, 7, 9, 9, 9, 20, 17,
+	17, 10, 17, 5, 17, 10, 17, 7, 9, 17, 9, 20, 17, 10, 17, 17, 17, 10, 7, 17, 10, 17, 7, 9,
+	7, 9, 9, 20, 17, 17, 10, 17, 5, 17, 10, 17, 7, 9, 9, 17, 20, 17, 17, 10, 10, 17, 17, 9,
+	9, 17, 17, 5, 20, 17, 17, 10, 10, 17, 17, 9, 9, 17, 17, 20, 17, 10, 14, 17, 17, 10, 17, 10,
+	17, 10, 19, 5, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 19, 5, 9, 17, 9, 9, 20,
+	17, 10, 14, 17, 17, 10, 17, 17, 10, 10, 19, 5, 9, 9, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17,
+	10, 19, 5, 9, 9, 17, 9, 20, 17, 10, 17, 17, 10, 17, 7, 9, 17, 17, 5, 9, 20, 17, 10, 17,
+	17, 10, 17, 7, 9, 17, 17, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 17, 10, 19, 5, 9, 9, 9,
+	9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 19, 5, 9, 17, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17,
+	10, 17, 7, 15, 7, 9, 19, 9, 9, 20, 17, 10, 14, 17, 17, 10, 17, 10, 19, 5, 9, 9, 9, 17,
+	20, 17, 10, 17, 17, 10, 17, 7, 9, 17, 17, 5, 9, 5, 20, 17, 10, 17, 17, 10, 17, 7, 9, 17,
+	9, 17, 20, 17, 10, 14, 17, 17, 17, 10, 17, 10, 10, 19, 5, 9, 9, 9, 9, 20, 17, 10, 14, 17,
+	17, 17, 10, 10, 19, 5, 9, 9, 17, 9, 20, 17, 10, 14, 17, 17, 17, 17, 10, 10, 10, 19, 5, 9,
+	9, 9, 9, 20, 17, 10, 14, 17, 17, 17, 10, 10, 19, 5, 9, 9, 9, 17, 20, 17, 10, 17, 17, 10,
+	17, 7, 9, 9, 17, 17, 5, 20, 17, 10, 17, 17, 10, 17, 7, 9, 9, 17, 17, 20, 17, 10, 17, 17,
+	5, 9, 17, 10, 17, 17, 5, 9, 20, 17, 10, 17, 17, 5, 9, 17, 10, 17, 17, 9, 20, 17, 10, 17,
+	17, 5, 9, 17, 17, 10, 17, 5, 9, 20, 17, 10, 17, 17, 5, 9, 17, 17, 5, 17, 20, 17, 10, 17,
+	17, 5, 9, 17, 17, 17, 5, 20, 17, 10, 17, 17, 5, 9, 17, 17, 17, 20, 17, 17, 5, 17, 10, 17,
+	10, 17, 10, 17, 5, 9, 9, 9, 20, 17, 17, 5, 17, 10, 17, 10, 17, 5, 17, 9, 9, 20, 17, 17,
+	5, 17, 10, 17, 10, 17, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 17, 10, 17, 17, 7, 9, 5, 17,
+	9, 20, 17, 17, 5, 17, 10, 17, 5, 17, 17, 5, 9, 20, 17, 17, 5, 17, 10, 17, 5, 17, 17, 9,
+	20, 17, 17, 5, 17, 17, 10, 10, 17, 10, 17, 5, 9, 9, 9, 20, 17, 17, 5, 17, 10, 17, 10, 17,
+	7, 17, 9, 9, 20, 17, 17, 5, 17, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 20, 17, 10, 17, 17,
+	10, 17, 17, 7, 9, 5, 9, 17, 20, 17, 17, 5, 17, 10, 17, 5, 17, 17, 5, 9, 5, 20, 17, 17,
+	5, 17, 10, 17, 5, 17, 9, 17, 20, 17, 17, 5, 17, 17, 10, 10, 17, 10, 17, 7, 9, 9, 9, 20,
+	17, 10, 17, 17, 17, 10, 17, 7, 9, 5, 17, 9, 20, 17, 17, 5, 17, 17, 17, 10, 10, 10, 17, 5,
+	9, 9, 9, 20, 17, 10, 17, 17, 17, 10, 17, 7, 9, 5, 9, 17, 20, 17, 10, 17, 17, 17, 5, 9,
+	5, 17, 17, 5, 20, 17, 10, 17, 17, 17, 5, 9, 5, 17, 17, 20, 17, 10, 17, 17, 9, 17, 10, 17,
+	17, 5, 9, 20, 17, 10, 17, 17, 9, 17, 10, 17, 17, 9, 20, 17, 10, 17, 17, 9, 17, 17, 10, 17,
+	5, 9, 20, 17, 10, 17, 17, 9, 17, 17, 5, 17, 20, 17, 10, 17, 17, 9, 17, 17, 17, 5, 20, 17,
+	10, 17, 17, 9, 17, 17, 17, 20, 17, 17, 10, 17, 10, 17, 10, 17, 10, 17, 5, 9, 9, 9, 9, 20,
+	17, 17, 10, 17, 10, 17, 10, 17, 5, 17, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 10, 17,
+	7, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 5, 9, 17, 9, 9, 20, 17, 17, 10, 17,
+	10, 17, 5, 17, 17, 5, 9, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 17, 9, 9, 20, 17, 17, 10,
+	17, 17, 10, 10, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 7, 17, 9,
+	9, 9, 20, 17, 17, 10, 17, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10,
+	17, 10, 17, 5, 9, 9, 17, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 17, 5, 9, 5, 9, 20, 17,
+	17, 10, 17, 10, 17, 5, 17, 9, 17, 9, 20, 17, 17, 10, 17, 17, 10, 10, 17, 10, 17, 7, 9, 9,
+	9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 7, 9, 17, 9, 9, 20, 17, 17, 10, 17, 17, 17, 10,
+	10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 7, 9, 9, 17, 9, 20, 17,
+	17, 10, 17, 10, 17, 5, 9, 17, 17, 5, 9, 20, 17, 17, 10, 17, 10, 17, 5, 9, 17, 17, 9, 20,
+	17, 17, 10, 17, 5, 17, 10, 17, 17, 5, 9, 9, 20, 17, 17, 10, 17, 5, 17, 10, 17, 17, 9, 9,
+	20, 17, 17, 10, 17, 5, 17, 17, 10, 17, 5, 9, 9, 20, 17, 17, 10, 17, 5, 17, 17, 5, 17, 9,
+	20, 17, 17, 10, 17, 5, 17, 17, 17, 5, 9, 20, 17, 17, 10, 17, 5, 17, 17, 17, 9, 20, 17, 17,
+	17, 10, 10, 17, 10, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 5, 17,
+	9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 17, 10,
+	10, 17, 10, 17, 5, 9, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 17, 7, 9, 9, 20, 17,
+	17, 10, 17, 10, 17, 7, 17, 17, 9, 9, 20, 17, 17, 10, 14, 17, 17, 10, 19, 10, 10, 17, 7, 9,
+	9, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 7, 17, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17,
+	10, 17, 17, 5, 13, 5, 9, 9, 9, 17, 20, 17, 17, 10, 17, 10, 17, 10, 17, 5, 9, 9, 9, 17,
+	20, 17, 17, 10, 17, 10, 14, 17, 17, 10, 7, 19, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17,
+	9, 9, 17, 20, 17, 17, 10, 14, 17, 17, 10, 19, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17,
+	17, 10, 10, 10, 17, 7, 9, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 17, 5, 13, 7, 9,
+	9, 9, 17, 20, 17, 17, 10, 17, 10, 17, 10, 17, 7, 9, 9, 9, 17, 20, 17, 17, 10, 17, 10, 17,
+	5, 9, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 10, 17, 5, 9, 17, 9, 17, 20, 17, 17, 10, 17,
+	5, 17, 10, 17, 17, 7, 9, 9, 20, 17, 17, 10, 17, 17, 10, 7, 17, 17, 9, 9, 20, 17, 17, 10,
+	17, 5, 17, 17, 10, 17, 7, 9, 9, 20, 17, 17, 10, 17, 5, 17, 17, 5, 9, 17, 20, 17, 17, 10,
+	17, 5, 17, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 5, 17, 17, 9, 17, 20, 17, 17, 17, 10, 17,
+	10, 10, 17, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 7, 17, 9, 9, 9,
+	20, 17, 17, 17, 10, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10,
+	17, 5, 9, 9, 17, 9, 20, 17, 17, 10, 17, 10, 17, 5, 17, 17, 7, 9, 5, 9, 20, 17, 17, 10,
+	17, 10, 17, 7, 17, 9, 17, 9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 10, 17, 5, 9, 9, 9, 9,
+	20, 17, 17, 17, 17, 10, 10, 10, 17, 5, 17, 9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 10, 17,
+	5, 15, 5, 9, 9, 19, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 5, 9, 9, 9, 17, 20, 17, 17,
+	10, 14, 17, 10, 17, 17, 10, 7, 19, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 7, 17, 9, 9, 17,
+	20, 17, 17, 17, 17, 10, 17, 10, 10, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10,
+	17, 7, 9, 9, 17, 9, 20, 17, 17, 17, 17, 17, 10, 10, 10, 10, 17, 7, 9, 9, 9, 9, 20, 17,
+	17, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 17, 20, 17, 17, 10, 17, 10, 17, 5, 9, 9, 17, 17,
+	5, 20, 17, 17, 10, 17, 10, 17, 5, 9, 9, 17, 17, 20, 17, 17, 10, 17, 5, 17, 10, 17, 17, 7,
+	9, 5, 9, 20, 17, 17, 10, 17, 17, 10, 7, 17, 9, 17, 9, 20, 17, 17, 10, 17, 5, 17, 17, 10,
+	17, 7, 9, 5, 9, 20, 17, 17, 10, 17, 5, 17, 17, 5, 9, 5, 17, 20, 17, 17, 10, 17, 5, 17,
+	9, 17, 17, 5, 20, 17, 17, 10, 17, 5, 17, 9, 17, 17, 20, 17, 17, 17, 10, 17, 10, 10, 17, 10,
+	17, 7, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 7, 9, 17, 9, 9, 20, 17, 17, 17,
+	10, 17, 17, 10, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 7, 9, 9,
+	17, 9, 20, 17, 17, 10, 17, 10, 17, 7, 9, 17, 17, 5, 9, 20, 17, 17, 10, 17, 10, 17, 7, 9,
+	17, 17, 9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 10, 17, 7, 9, 9, 9, 9, 20, 17, 17, 17, 17,
+	10, 10, 10, 17, 5, 9, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 10, 17, 7, 15, 7, 9, 19,
+	9, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 7, 9, 9, 9, 17, 20, 17, 17, 10, 17, 10, 17, 7,
+	9, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 10, 17, 7, 9, 17, 9, 17, 20, 17, 17, 17, 17, 10,
+	17, 10, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 5, 9, 9, 17, 9,
+	20, 17, 17, 17, 17, 17, 10, 10, 10, 10, 17, 5, 9, 9, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10,
+	17, 5, 9, 9, 9, 17, 20, 17, 17, 10, 17, 10, 17, 7, 9, 9, 17, 17, 5, 20, 17, 17, 10, 17,
+	10, 17, 7, 9, 9, 17, 17, 20, 17, 17, 10, 17, 5, 9, 17, 10, 17, 17, 5, 9, 20, 17, 17, 10,
+	17, 5, 9, 17, 10, 17, 17, 9, 20, 17, 17, 10, 17, 5, 9, 17, 17, 10, 17, 5, 9, 20, 17, 17,
+	10, 17, 5, 9, 17, 17, 5, 17, 20, 17, 17, 10, 17, 5, 9, 17, 17, 17, 5, 20, 17, 17, 10, 17,
+	5, 9, 17, 17, 17, 20, 17, 17, 5, 17, 10, 17, 10, 17, 17, 5, 9, 9, 20, 17, 17, 5, 17, 10,
+	17, 10, 17, 17, 9, 9, 20, 17, 17, 5, 17, 10, 17, 17, 10, 17, 5, 9, 9, 20, 17, 17, 5, 17,
+	10, 17, 17, 5, 17, 9, 20, 17, 17, 5, 17, 10, 17, 17, 17, 5, 9, 20, 17, 17, 5, 17, 10, 17,
+	17, 17, 9, 20, 17, 17, 5, 17, 10, 17, 10, 17, 17, 7, 9, 9, 20, 17, 17, 5, 17, 17, 10, 10,
+	17, 17, 9, 9, 20, 17, 17, 5, 17, 10, 17, 17, 10, 17, 7, 9, 9, 20, 17, 17, 5, 17, 10, 17,
+	17, 5, 9, 17, 20, 17, 17, 5, 17, 10, 17, 17, 17, 5, 9, 5, 20, 17, 17, 5, 17, 10, 17, 17,
+	9, 17, 20, 17, 17, 5, 17, 17, 10, 17, 10, 17, 5, 9, 9, 20, 17, 17, 5, 17, 17, 10, 17, 5,
+	17, 9, 20, 17, 17, 5, 17, 17, 10, 17, 10, 17, 7, 9, 9, 20, 17, 17, 5, 17, 17, 10, 17, 5,
+	9, 17, 20, 17, 17, 5, 17, 17, 5, 17, 17, 5, 20, 17, 17, 5, 17, 17, 5, 17, 17, 20, 17, 17,
+	5, 17, 17, 10, 17, 17, 5, 9, 20, 17, 17, 5, 17, 17, 10, 17, 17, 9, 20, 17, 17, 5, 17, 17,
+	17, 10, 17, 5, 9, 20, 17, 17, 5, 17, 17, 17, 5, 17, 20, 17, 17, 5, 17, 17, 17, 17, 5, 20,
+	17, 17, 5, 17, 17, 17, 17, 20, 17, 17, 10, 17, 10, 17, 10, 17, 17, 5, 9, 9, 9, 20, 17, 17,
+	10, 17, 10, 17, 10, 17, 17, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 10, 17, 5, 9, 9, 9,
+	20, 17, 17, 10, 17, 10, 17, 17, 5, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 17, 5, 9, 9,
+	20, 17, 17, 10, 17, 10, 17, 17, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 10, 17, 17, 7, 9, 9,
+	9, 20, 17, 17, 10, 17, 17, 10, 10, 17, 17, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 10, 17,
+	7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 5, 9, 17, 9, 20, 17, 17, 10, 17, 10, 17, 17,
+	17, 5, 9, 5, 9, 20, 17, 17, 10, 17, 10, 17, 17, 9, 17, 9, 20, 17, 17, 10, 17, 17, 10, 17,
+	10, 17, 5, 9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 5, 17, 9, 9, 20, 17, 17, 10, 17, 17,
+	10, 17, 10, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 5, 9, 17, 9, 20, 17, 17, 10,
+	17, 17, 5, 17, 17, 5, 9, 20, 17, 17, 10, 17, 17, 5, 17, 17, 9, 20, 17, 17, 10, 17, 17, 10,
+	17, 17, 5, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 17, 9, 9, 20, 17, 17, 10, 17, 17, 17, 10,
+	17, 5, 9, 9, 20, 17, 17, 10, 17, 17, 17, 5, 17, 9, 20, 17, 17, 10, 17, 17, 17, 17, 5, 9,
+	20, 17, 17, 10, 17, 17, 17, 17, 9, 20, 17, 17, 17, 10, 10, 17, 10, 17, 17, 5, 9, 9, 9, 20,
+	17, 17, 10, 17, 10, 17, 17, 5, 17, 7, 9, 9, 20, 17, 17, 17, 10, 10, 17, 17, 10, 17, 5, 9,
+	9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 7, 17, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 17, 7,
+	9, 9, 20, 17, 17, 17, 10, 10, 17, 17, 17, 9, 9, 20, 17, 17, 17, 17, 10, 10, 10, 17, 17, 7,
+	9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 5, 17, 7, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17,
+	10, 17, 7, 9, 6, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 5, 9, 9, 17, 20, 17, 17, 10, 17,
+	17, 5, 17, 10, 17, 7, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 9, 9, 17, 20, 17, 17, 10, 14,
+	17, 17, 10, 17, 10, 19, 7, 9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 7, 17, 9, 9, 20, 17,
+	17, 10, 14, 17, 17, 17, 10, 10, 19, 7, 9, 9, 9, 20, 17, 17, 10, 17, 17, 10, 17, 5, 9, 9,
+	17, 20, 17, 17, 10, 17, 17, 5, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 17, 5, 17, 9, 17, 20,
+	17, 17, 10, 17, 17, 10, 17, 17, 7, 9, 9, 20, 17, 17, 10, 14, 17, 17, 10, 17, 19, 9, 9, 20,
+	17, 17, 10, 17, 17, 17, 10, 17, 7, 9, 9, 20, 17, 17, 10, 17, 17, 17, 5, 9, 17, 20, 17, 17,
+	10, 17, 17, 17, 17, 5, 9, 5, 20, 17, 17, 10, 17, 17, 17, 9, 17, 20, 17, 17, 17, 10, 10, 17,
+	10, 17, 17, 7, 9, 9, 9, 20, 17, 17, 17, 10, 17, 10, 10, 17, 17, 9, 9, 9, 20, 17, 17, 17,
+	10, 10, 17, 17, 10, 17, 7, 9, 9, 9, 20, 17, 17, 10, 17, 10, 17, 17, 7, 9, 17, 9, 20, 17,
+	17, 10, 17, 10, 17, 17, 17, 7, 9, 5, 9, 20, 17, 17, 17, 10, 10, 17, 17, 9, 17, 9, 20, 17,
+	17, 17, 17, 10, 10, 10, 17, 17, 5, 9, 9, 9, 20, 17, 17, 17, 10, 17, 10, 17, 5, 17, 7, 9,
+	9, 20, 17, 17, 10, 17, 10, 17, 17, 17, 5, 13, 7, 9, 9, 17, 20, 17, 17, 10, 17, 10, 17, 17,
+	7, 9, 9, 17, 20, 17, 17, 17, 10, 17, 5, 17, 10, 17, 7, 9, 9, 20, 17, 17, 17, 10, 10, 17,
+	17, 9, 9, 17, 20, 17, 17, 10, 14, 17, 17, 10, 17, 10, 19, 5, 9, 9, 9, 20, 17, 17, 10, 17,
+	17, 10, 17, 7, 9, 17, 9, 20, 17, 17, 10, 14, 17, 17, 17, 10, 10, 19, 5, 9, 9, 9, 20, 17,
+	17, 10, 17, 17, 10, 17, 7, 9, 9, 17, 20, 17, 17, 10, 17, 17, 5, 9, 17, 17, 5, 20, 17, 17,
+	10, 17, 17, 5, 9, 17, 17, 20, 17, 17, 10, 17, 17, 10, 17, 17, 7, 9, 5, 9, 20, 17, 17, 17,
+	5, 17, 10, 17, 5, 17, 9, 20, 17, 17, 10, 17, 17, 17, 10, 17, 7, 9, 5, 9, 20, 17, 17, 10,
+	17, 17, 17, 5, 9, 5, 17, 20, 17, 17, 10, 17, 17, 9, 17, 17, 5, 20, 17, 17, 10, 17, 17, 9,
+	17, 17, 20, 17, 17, 17, 10, 17, 10, 17, 10, 17, 5, 9, 9, 9, 20, 17, 17, 17, 10, 17, 10, 17,
+	5, 17, 9, 9, 20, 17, 17, 17, 10, 17, 10, 17, 10, 17, 7, 9, 9, 9, 20, 17, 17, 17, 10, 17,
+	10, 17, 5, 9, 17, 9, 20, 17, 17, 17, 10, 17, 5, 17, 17, 5, 9, 20, 17, 17, 17, 10, 17, 5,
+	17, 17, 9, 20, 17, 17, 17, 17, 10, 10, 17, 10, 17, 5, 9, 9, 9, 20, 17, 17, 17, 10, 17, 10,
+	17, 7, 17, 9, 9, 20, 17, 17, 17, 17, 17, 10, 10, 10, 17, 7, 9, 9, 9, 20, 17, 17, 17, 10,
+	17, 10, 17, 5, 9, 9, 17, 20, 17, 17, 17, 10, 17, 5, 17, 17, 5, 9, 5, 20, 17, 17, 17, 10,
+	17, 5, 17, 9, 17, 20, 17, 17, 17, 17, 10, 10, 17, 10, 17, 7, 9, 9, 9, 20, 17, 17, 17, 10,
+	17, 10, 17, 7, 9, 17, 9, 20, 17, 17, 17, 17, 17, 10, 10, 10, 17, 5, 9, 9, 9, 20, 17, 17,
+	17, 10, 17, 10, 17, 7, 9, 9, 17, 20, 17, 17, 17, 10, 17, 5, 9, 17, 17, 5, 20, 17, 17, 17,
+	10, 17, 5, 9, 17, 17, 20, 17, 17, 17, 5, 17, 10, 17, 17, 5, 9, 20, 17, 17, 17, 5, 17, 10,
+	17, 17, 9, 20, 17, 17, 17, 5, 17, 17, 10, 17, 5, 9, 20, 17, 17, 17, 5, 17, 17, 5, 17, 20,
+	17, 17, 17, 5, 17, 17, 17, 5, 20, 17, 17, 17, 5, 17, 17, 17, 20, 17, 17, 17, 10, 17, 10, 17,
+	17, 5, 9, 9, 20, 17, 17, 17, 10, 17, 10, 17, 17, 9, 9, 20, 17, 17, 17, 10, 17, 17, 10, 17,
+	5, 9, 9, 20, 17, 17, 17, 10, 17, 17, 5, 17, 9, 20, 17, 17, 17, 10, 17, 17, 17, 5, 9, 20,
+	17, 17, 17, 10, 17, 17, 17, 9, 20, 17, 17, 17, 10, 17, 10, 17, 17, 7, 9, 9, 20, 17, 17, 17,
+	17, 10, 10, 17, 17, 9, 9, 20, 17, 17, 17, 10, 17, 17, 10, 17, 7, 9, 9, 20, 17, 17, 17, 10,
+	17, 17, 5, 9, 17, 20, 17, 17, 17, 10, 17, 17, 17, 5, 9, 5, 20, 17, 17, 17, 10, 17, 17, 9,
+	17, 20, 17, 17, 17, 17, 10, 17, 10, 17, 5, 9, 9, 20, 17, 17, 17, 17, 10, 17, 5, 17, 9, 20,
+	17, 17, 17, 17, 10, 17, 10, 17, 7, 9, 9, 20, 17, 17, 17, 17, 10, 17, 5, 9, 17, 20, 17, 17,
+	17, 17, 5, 17, 17, 5, 20, 17, 17, 17, 17, 5, 17, 17, 20, 17, 17, 17, 17, 10, 17, 17, 5, 9,
+	20, 17, 17, 17, 17, 10, 17, 17, 9, 20, 17, 17, 17, 17, 17, 10, 17, 5, 9, 20, 17, 17, 17, 17,
+	17, 5, 17, 20, 17, 17, 17, 17, 17, 17, 5, 20, 17, 17, 17, 17, 17, 17, 20, 9, 15, 9, 15, 6,
+	9, 9, 18, 9, 19, 9, 17, 20, 9, 15, 9, 15, 9, 9, 18, 9, 19, 9, 17, 20, 9, 15, 9, 9,
+	7, 13, 9, 5, 9, 19, 9, 17, 20, 9, 15, 9, 6, 13, 9, 9, 9, 19, 9, 17, 20, 9, 15, 9,
+	9, 7, 13, 9, 9, 19, 9, 17, 20, 9, 15, 9, 13, 9, 9, 9, 19, 9, 17, 20, 6, 9, 15, 9,
+	15, 6, 9, 9, 19, 9, 19, 9, 20, 6, 9, 15, 9, 15, 9, 9, 19, 9, 19, 9, 20, 14, 9, 15,
+	9, 6, 9, 5, 18, 9, 9, 19, 9, 20, 14, 9, 15, 6, 9, 9, 18, 9, 9, 19, 9, 20, 6, 9,
+	15, 9, 9, 7, 9, 5, 9, 19, 9, 20, 14, 9, 15, 9, 9, 18, 9, 9, 19, 9, 20, 9, 15, 9,
+	9, 6, 13, 9, 5, 9, 19, 9, 17, 20, 6, 9, 15, 9, 6, 9, 7, 9, 9, 19, 9, 20, 6, 9,
+	15, 9, 9, 15, 9, 5, 19, 9, 19, 9, 20, 6, 9, 15, 9, 6, 9, 5, 9, 9, 19, 9, 20, 6,
+	9, 15, 9, 9, 7, 9, 9, 19, 9, 20, 6, 9, 15, 6, 9, 9, 9, 9, 19, 9, 20, 9, 15, 9,
+	9, 6, 13, 9, 9, 19, 9, 17, 20, 9, 15, 9, 9, 13, 9, 9, 19, 9, 17, 20, 6, 9, 15, 9,
+	9, 6, 9, 5, 9, 19, 9, 20, 6, 9, 15, 9, 6, 9, 9, 9, 19, 9, 20, 6, 9, 15, 9, 9,
+	6, 9, 9, 19, 9, 20, 6, 9, 15, 9, 9, 9, 9, 19, 9, 20, 6, 9, 9, 15, 15, 6, 9, 9,
+	18, 9, 19, 9, 17, 20, 6, 9, 9, 15, 15, 9, 9, 18, 9, 19, 9, 17, 20, 9, 13, 9, 15, 9,
+	6, 9, 5, 9, 19, 9, 17, 20, 9, 13, 9, 15, 6, 9, 9, 9, 19, 9, 17, 20, 9, 13, 9, 15,
+	9, 6, 9, 9, 19, 9, 17, 20, 9, 13, 9, 15, 9, 9, 9, 19, 9, 17, 20, 9, 15, 9, 15, 6,
+	9, 9, 18, 19, 9, 9, 17, 20, 9, 15, 9, 15, 9, 9, 18, 19, 9, 9, 17, 20, 9, 15, 9, 9,
+	7, 13, 9, 5, 19, 9, 9, 17, 20, 9, 15, 9, 6, 13, 9, 9, 19, 9, 9, 17, 20, 9, 15, 9,
+	9, 7, 9, 5, 18, 9, 9, 17, 20, 9, 15, 9, 13, 9, 9, 19, 9, 9, 17, 20, 6, 9, 15, 9,
+	14, 6, 9, 5, 9, 19, 9, 18, 9, 20, 9, 15, 9, 6, 9, 7, 9, 18, 9, 9, 17, 20, 9, 15,
+	9, 9, 6, 13, 9, 5, 19, 9, 9, 17, 20, 9, 15, 9, 6, 9, 5, 9, 18, 9, 9, 17, 20, 9,
+	15, 9, 9, 7, 9, 18, 9, 9, 17, 20, 9, 15, 6, 9, 9, 9, 18, 9, 9, 17, 20, 6, 9, 15,
+	9, 14, 6, 9, 9, 19, 9, 18, 9, 20, 6, 9, 15, 9, 14, 9, 9, 19, 9, 18, 9, 20, 9, 15,
+	9, 9, 6, 9, 5, 18, 9, 9, 17, 20, 9, 15, 9, 6, 9, 9, 18, 9, 9, 17, 20, 9, 15, 9,
+	9, 6, 9, 18, 9, 9, 17, 20, 9, 15, 9, 9, 9, 18, 9, 9, 17, 20, 14, 9, 9, 13, 15, 6,
+	9, 9, 19, 9, 19, 9, 20, 14, 9, 9, 13, 15, 9, 9, 19, 9, 19, 9, 20, 9, 13, 9, 15, 9,
+	6, 9, 5, 9, 19, 5, 9, 17, 20, 9, 13, 9, 15, 6, 9, 9, 9, 19, 5, 9, 17, 20, 14, 9,
+	9, 13, 9, 7, 9, 5, 9, 19, 9, 20, 9, 9, 7, 13, 9, 7, 9, 7, 9, 9, 17, 20, 6, 9,
+	9, 15, 15, 6, 9, 9, 18, 19, 9, 9, 17, 20, 6, 9, 9, 15, 15, 9, 9, 18, 19, 9, 9, 17,
+	20, 9, 13, 9, 15, 9, 6, 9, 5, 19, 9, 9, 17, 20, 9, 13, 9, 15, 6, 9, 9, 19, 9, 9,
+	17, 20, 9, 13, 9, 15, 9, 6, 9, 19, 9, 9, 17, 20, 9, 13, 9, 15, 9, 9, 19, 9, 9, 17,
+	20, 9, 13, 9, 9, 7, 15, 6, 9, 5, 19, 9, 9, 17, 20, 9, 15, 9, 6, 9, 7, 18, 9, 9,
+	9, 17, 20, 9, 15, 9, 15, 6, 9, 18, 19, 9, 9, 9, 17, 20, 9, 15, 9, 6, 9, 5, 18, 9,
+	9, 9, 17, 20, 9, 15, 9, 9, 7, 18, 9, 9, 9, 17, 20, 9, 15, 6, 9, 9, 18, 9, 9, 9,
+	17, 20, 14, 9, 9, 9, 13, 7, 9, 5, 9, 19, 9, 20, 9, 13, 9, 9, 7, 9, 7, 9, 9, 17,
+	20, 6, 9, 15, 9, 9, 6, 9, 5, 19, 7, 9, 9, 20, 9, 13, 9, 9, 7, 9, 5, 9, 9, 17,
+	20, 9, 6, 13, 9, 9, 9, 7, 9, 9, 17, 20, 9, 15, 9, 9, 18, 9, 9, 9, 17, 20, 14, 9,
+	9, 15, 6, 9, 5, 9, 18, 9, 19, 9, 20, 14, 9, 9, 6, 13, 9, 7, 9, 9, 19, 9, 20, 14,
+	9, 9, 13, 9, 15, 9, 5, 19, 9, 19, 9, 20, 14, 9, 9, 6, 13, 9, 5, 9, 9, 19, 9, 20,
+	14, 9, 9, 13, 9, 7, 9, 9, 19, 9, 20, 14, 9, 9, 13, 9, 5, 9, 9, 19, 9, 20, 9, 13,
+	9, 9, 15, 6, 9, 5, 9, 19, 9, 17, 20, 9, 13, 9, 9, 15, 9, 5, 9, 19, 9, 17, 20, 6,
+	9, 9, 15, 9, 6, 13, 9, 5, 19, 9, 9, 17, 20, 6, 9, 9, 15, 6, 9, 5, 9, 18, 9, 9,
+	17, 20, 6, 9, 9, 15, 9, 7, 9, 18, 9, 9, 17, 20, 9, 9, 7, 13, 9, 7, 9, 9, 9, 17,
+	20, 14, 9, 9, 9, 13, 15, 9, 5, 19, 9, 19, 9, 20, 6, 9, 9, 15, 6, 9, 7, 18, 9, 9,
+	9, 17, 20, 9, 13, 9, 9, 15, 6, 9, 5, 19, 9, 9, 17, 20, 9, 13, 9, 9, 15, 9, 5, 19,
+	9, 9, 17, 20, 6, 9, 9, 15, 9, 7, 18, 9, 9, 9, 17, 20, 9, 9, 7, 13, 9, 5, 9, 9,
+	9, 17, 20, 14, 9, 9, 9, 13, 7, 9, 9, 19, 9, 20, 9, 13, 9, 9, 7, 9, 6, 9, 9, 17,
+	20, 9, 6, 13, 9, 9, 9, 6, 9, 5, 9, 17, 20, 9, 13, 9, 9, 7, 9, 9, 9, 17, 20, 9,
+	6, 13, 9, 9, 9, 6, 9, 9, 17, 20, 9, 6, 13, 9, 9, 9, 9, 9, 17, 20, 14, 9, 9, 15,
+	6, 9, 9, 18, 9, 19, 9, 20, 14, 9, 9, 15, 9, 9, 18, 9, 19, 9, 20, 14, 9, 9, 9, 7,
+	13, 9, 5, 9, 19, 9, 20, 14, 9, 9, 6, 13, 9, 9, 9, 19, 9, 20, 14, 9, 9, 9, 7, 13,
+	9, 9, 19, 9, 20, 14, 9, 9, 13, 9, 9, 9, 19, 9, 20, 9, 13, 9, 9, 15, 6, 9, 9, 19,
+	9, 17, 20, 9, 13, 9, 9, 15, 9, 9, 19, 9, 17, 20, 6, 9, 9, 15, 9, 6, 9, 5, 18, 9,
+	9, 17, 20, 6, 9, 9, 15, 6, 9, 9, 18, 9, 9, 17, 20, 9, 13, 9, 9, 9, 7, 9, 5, 9,
+	17, 20, 6, 9, 9, 15, 9, 9, 18, 9, 9, 17, 20, 14, 9, 9, 9, 6, 13, 9, 5, 9, 19, 9,
+	20, 9, 13, 9, 9, 6, 9, 7, 9, 9, 17, 20, 9, 13, 9, 9, 9, 15, 9, 5, 19, 9, 17, 20,
+	9, 13, 9, 9, 6, 9, 5, 9, 9, 17, 20, 9, 13, 9, 9, 9, 7, 9, 9, 17, 20, 9, 9, 7,
+	13, 9, 9, 9, 9, 17, 20, 14, 9, 9, 9, 6, 13, 9, 9, 19, 9, 20, 14, 9, 9, 9, 13, 9,
+	9, 19, 9, 20, 9, 13, 9, 9, 9, 6, 9, 5, 9, 17, 20, 9, 13, 9, 9, 6, 9, 9, 9, 17,
+	20, 9, 13, 9, 9, 9, 6, 9, 9, 17, 20, 9, 13, 9, 9, 9, 9, 9, 17, 20, 9, 14, 15, 9,
+	6, 13, 9, 9, 19, 9, 19, 9, 20, 9, 14, 15, 9, 13, 9, 9, 19, 9, 19, 9, 20, 9, 14, 15,
+	9, 6, 9, 5, 9, 18, 9, 19, 9, 20, 9, 14, 15, 6, 9, 9, 9, 18, 9, 19, 9, 20, 9, 14,
+	15, 9, 6, 9, 9, 18, 9, 19, 9, 20, 9, 14, 15, 9, 9, 9, 18, 9, 19, 9, 20, 9, 15, 9,
+	15, 6, 9, 9, 19, 9, 19, 9, 20, 9, 15, 9, 15, 9, 9, 19, 9, 19, 9, 20, 9, 14, 15, 9,
+	6, 9, 5, 18, 9, 9, 19, 9, 20, 9, 14, 15, 6, 9, 9, 18, 9, 9, 19, 9, 20, 9, 15, 9,
+	9, 7, 9, 5, 9, 19, 9, 20, 9, 14, 15, 9, 9, 18, 9, 9, 19, 9, 20, 9, 15, 9, 6, 9,
+	15, 9, 5, 19, 9, 19, 9, 20, 9, 15, 9, 6, 9, 7, 9, 9, 19, 9, 20, 9, 15, 9, 9, 15,
+	9, 5, 19, 9, 19, 9, 20, 9, 15, 9, 6, 9, 5, 9, 9, 19, 9, 20, 9, 15, 9, 9, 7, 9,
+	9, 19, 9, 20, 9, 15, 6, 9, 9, 9, 9, 19, 9, 20, 9, 15, 9, 6, 9, 6, 9, 5, 9, 19,
+	9, 20, 9, 15, 9, 6, 9, 6, 9, 9, 19, 9, 20, 9, 15, 9, 9, 6, 9, 5, 9, 19, 9, 20,
+	9, 15, 9, 6, 9, 9, 9, 19, 9, 20, 9, 15, 9, 9, 6, 9, 9, 19, 9, 20, 9, 15, 9, 9,
+	9, 9, 19, 9, 20, 14, 9, 15, 9, 6, 13, 9, 9, 19, 19, 9, 9, 20, 14, 9, 15, 9, 13, 9,
+	9, 19, 19, 9, 9, 20, 9, 13, 9, 15, 9, 6, 9, 5, 9, 17, 19, 9, 20, 9, 13, 9, 15, 6,
+	9, 9, 9, 17, 19, 9, 20, 9, 13, 9, 15, 9, 6, 9, 9, 17, 19, 9, 20, 9, 13, 9, 15, 9,
+	9, 9, 17, 19, 9, 20, 6, 9, 15, 9, 15, 6, 9, 9, 19, 19, 9, 9, 20, 6, 9, 15, 9, 15,
+	9, 9, 19, 19, 9, 9, 20, 9, 15, 9, 9, 7, 13, 9, 5, 19, 9, 17, 9, 20, 9, 15, 9, 6,
+	13, 9, 9, 19, 9, 17, 9, 20, 6, 9, 15, 9, 9, 7, 9, 5, 19, 9, 9, 20, 9, 15, 9, 13,
+	9, 9, 19, 9, 17, 9, 20, 6, 9, 15, 9, 6, 9, 15, 9, 5, 19, 19, 9, 9, 20, 6, 9, 15,
+	9, 6, 9, 7, 9, 19, 9, 9, 20, 6, 9, 15, 9, 9, 15, 9, 5, 19, 19, 9, 9, 20, 6, 9,
+	15, 9, 6, 9, 5, 9, 19, 9, 9, 20, 6, 9, 15, 9, 9, 7, 9, 19, 9, 9, 20, 6, 9, 15,
+	6, 9, 9, 9, 19, 9, 9, 20, 6, 9, 15, 9, 6, 9, 6, 9, 5, 19, 9, 9, 20, 6, 9, 15,
+	9, 6, 9, 6, 9, 19, 9, 9, 20, 6, 9, 15, 9, 9, 6, 9, 5, 19, 9, 9, 20, 6, 9, 15,
+	9, 6, 9, 9, 19, 9, 9, 20, 6, 9, 15, 9, 9, 6, 9, 19, 9, 9, 20, 6, 9, 15, 9, 9,
+	9, 19, 9, 9, 20, 6, 9, 9, 15, 15, 6, 9, 9, 19, 9, 19, 9, 20, 6, 9, 9, 15, 15, 9,
+	9, 19, 9, 19, 9, 20, 9, 13, 9, 15, 9, 6, 9, 5, 17, 9, 19, 9, 20, 9, 13, 9, 15, 6,
+	9, 9, 17, 9, 19, 9, 20, 6, 9, 9, 15, 9, 7, 9, 5, 9, 19, 9, 20, 9, 13, 9, 15, 9,
+	9, 17, 9, 19, 9, 20, 9, 9, 7, 15, 15, 6, 9, 9, 19, 9, 19, 9, 20, 9, 9, 7, 15, 15,
+	9, 9, 19, 9, 19, 9, 20, 9, 13, 9, 15, 9, 6, 9, 5, 19, 9, 17, 9, 20, 9, 13, 9, 15,
+	6, 9, 9, 19, 9, 17, 9, 20, 9, 13, 9, 15, 9, 6, 9, 19, 9, 17, 9, 20, 9, 13, 9, 15,
+	9, 9, 19, 9, 17, 9, 20, 9, 6, 9, 7, 15, 9, 15, 9, 5, 19, 9, 19, 9, 20, 9, 15, 9,
+	6, 9, 7, 18, 9, 9, 17, 9, 20, 9, 15, 9, 15, 6, 9, 18, 19, 9, 9, 17, 9, 20, 9, 15,
+	9, 6, 9, 5, 18, 9, 9, 17, 9, 20, 9, 15, 9, 9, 7, 18, 9, 9, 17, 9, 20, 9, 15, 6,
+	9, 9, 18, 9, 9, 17, 9, 20, 9, 9, 7, 15, 9, 7, 9, 5, 9, 19, 9, 20, 9, 13, 9, 9,
+	7, 9, 7, 9, 17, 9, 20, 14, 9, 9, 9, 13, 7, 9, 5, 19, 9, 9, 20, 9, 13, 9, 9, 7,
+	9, 5, 9, 17, 9, 20, 9, 6, 13, 9, 9, 9, 7, 9, 17, 9, 20, 9, 15, 9, 9, 18, 9, 9,
+	17, 9, 20, 6, 9, 9, 14, 15, 6, 9, 5, 9, 18, 9, 19, 9, 20, 6, 9, 9, 15, 6, 9, 7,
+	9, 9, 19, 9, 20, 6, 9, 9, 15, 9, 15, 9, 5, 19, 9, 19, 9, 20, 6, 9, 9, 15, 6, 9,
+	5, 9, 9, 19, 9, 20, 6, 9, 9, 15, 9, 7, 9, 9, 19, 9, 20, 6, 9, 9, 15, 9, 5, 9,
+	9, 19, 9, 20, 9, 13, 9, 9, 15, 6, 9, 5, 9, 17, 19, 9, 20, 9, 9, 7, 15, 6, 9, 7,
+	9, 9, 19, 9, 20, 14, 9, 9, 13, 9, 15, 9, 5, 19, 19, 9, 9, 20, 14, 9, 9, 6, 13, 9,
+	5, 9, 19, 9, 9, 20, 14, 9, 9, 13, 9, 7, 9, 19, 9, 9, 20, 9, 9, 7, 13, 9, 7, 9,
+	9, 17, 9, 20, 9, 9, 7, 15, 9, 15, 9, 5, 19, 9, 19, 9, 20, 9, 9, 7, 15, 6, 9, 5,
+	9, 9, 19, 9, 20, 9, 13, 9, 9, 15, 6, 9, 5, 19, 9, 17, 9, 20, 9, 13, 9, 9, 15, 9,
+	5, 19, 9, 17, 9, 20, 6, 9, 9, 15, 9, 7, 18, 9, 9, 17, 9, 20, 9, 9, 7, 13, 9, 5,
+	9, 9, 17, 9, 20, 9, 9, 7, 15, 9, 7, 9, 9, 19, 9, 20, 9, 6, 9, 7, 15, 9, 9, 9,
+	19, 9, 20, 14, 9, 9, 9, 13, 7, 9, 19, 9, 9, 20, 9, 13, 9, 9, 7, 9, 9, 17, 9, 20,
+	9, 6, 13, 9, 9, 9, 6, 9, 17, 9, 20, 9, 6, 13, 9, 9, 9, 9, 17, 9, 20, 6, 9, 9,
+	14, 15, 6, 9, 9, 18, 9, 19, 9, 20, 6, 9, 9, 14, 15, 9, 9, 18, 9, 19, 9, 20, 6, 9,
+	9, 15, 9, 6, 9, 5, 9, 19, 9, 20, 6, 9, 9, 15, 6, 9, 9, 9, 19, 9, 20, 6, 9, 9,
+	15, 9, 6, 9, 9, 19, 9, 20, 6, 9, 9, 15, 9, 9, 9, 19, 9, 20, 9, 13, 9, 9, 15, 6,
+	9, 9, 17, 19, 9, 20, 9, 13, 9, 9, 15, 9, 9, 17, 19, 9, 20, 14, 9, 9, 9, 7, 13, 9,
+	5, 19, 9, 9, 20, 14, 9, 9, 6, 13, 9, 9, 19, 9, 9, 20, 9, 13, 9, 9, 9, 7, 9, 5,
+	17, 9, 20, 14, 9, 9, 13, 9, 9, 19, 9, 9, 20, 9, 9, 7, 15, 9, 6, 9, 5, 9, 19, 9,
+	20, 9, 9, 7, 15, 6, 9, 9, 9, 19, 9, 20, 9, 13, 9, 9, 9, 15, 9, 5, 17, 19, 9, 20,
+	9, 13, 9, 9, 6, 9, 5, 9, 17, 9, 20, 9, 13, 9, 9, 9, 7, 9, 17, 9, 20, 9, 9, 7,
+	13, 9, 9, 9, 17, 9, 20, 9, 9, 7, 15, 9, 6, 9, 9, 19, 9, 20, 9, 9, 7, 15, 9, 9,
+	9, 19, 9, 20, 9, 13, 9, 9, 9, 6, 9, 5, 17, 9, 20, 9, 13, 9, 9, 6, 9, 9, 17, 9,
+	20, 9, 13, 9, 9, 9, 6, 9, 17, 9, 20, 9, 13, 9, 9, 9, 9, 17, 9, 20, 9, 9, 15, 15,
+	6, 9, 9, 18, 9, 19, 9, 17, 20, 9, 9, 15, 15, 9, 9, 18, 9, 19, 9, 17, 20, 9, 9, 13,
+	15, 9, 6, 9, 5, 9, 19, 9, 17, 20, 9, 9, 13, 15, 6, 9, 9, 9, 19, 9, 17, 20, 9, 9,
+	13, 15, 9, 6, 9, 9, 19, 9, 17, 20, 9, 9, 13, 15, 9, 9, 9, 19, 9, 17, 20, 9, 15, 9,
+	15, 6, 9, 9, 17, 19, 9, 18, 9, 20, 9, 15, 9, 15, 9, 9, 17, 19, 9, 18, 9, 20, 6, 9,
+	15, 9, 9, 7, 13, 9, 5, 19, 9, 9, 17, 20, 6, 9, 15, 9, 6, 13, 9, 9, 19, 9, 9, 17,
+	20, 9, 15, 9, 9, 7, 9, 5, 9, 19, 5, 9, 20, 6, 9, 15, 9, 13, 9, 9, 19, 9, 9, 17,
+	20, 9, 15, 9, 14, 6, 9, 5, 9, 19, 9, 18, 9, 20, 9, 15, 9, 6, 9, 7, 9, 9, 19, 5,
+	9, 20, 9, 15, 9, 9, 15, 9, 5, 17, 19, 9, 18, 9, 20, 9, 15, 9, 6, 9, 5, 9, 9, 19,
+	5, 9, 20, 9, 15, 9, 9, 7, 9, 9, 19, 5, 9, 20, 9, 15, 6, 9, 9, 9, 9, 19, 5, 9,
+	20, 9, 15, 9, 14, 6, 9, 9, 19, 9, 18, 9, 20, 9, 15, 9, 14, 9, 9, 19, 9, 18, 9, 20,
+	9, 15, 9, 9, 6, 9, 5, 9, 19, 5, 9, 20, 9, 15, 9, 6, 9, 9, 9, 19, 5, 9, 20, 9,
+	15, 9, 9, 6, 9, 9, 19, 5, 9, 20, 9, 15, 9, 9, 9, 9, 19, 5, 9, 20, 9, 9, 15, 15,
+	6, 9, 9, 18, 9, 17, 19, 9, 20, 9, 9, 15, 15, 9, 9, 18, 9, 17, 19, 9, 20, 9, 9, 13,
+	15, 9, 6, 9, 5, 9, 17, 19, 9, 20, 9, 9, 13, 15, 6, 9, 9, 9, 17, 19, 9, 20, 9, 9,
+	13, 15, 9, 6, 9, 9, 17, 19, 9, 20, 9, 9, 13, 15, 9, 9, 9, 17, 19, 9, 20, 9, 15, 9,
+	15, 6, 9, 9, 19, 19, 9, 9, 20, 9, 15, 9, 15, 9, 9, 19, 19, 9, 9, 20, 9, 14, 15, 9,
+	6, 9, 5, 18, 9, 19, 9, 9, 20, 9, 14, 15, 6, 9, 9, 18, 9, 19, 9, 9, 20, 9, 15, 9,
+	9, 7, 9, 5, 19, 9, 9, 20, 9, 14, 15, 9, 9, 18, 9, 19, 9, 9, 20, 9, 15, 9, 6, 9,
+	15, 9, 5, 19, 19, 9, 9, 20, 9, 15, 9, 6, 9, 7, 9, 19, 9, 9, 20, 9, 15, 9, 9, 15,
+	9, 5, 19, 19, 9, 9, 20, 9, 15, 9, 6, 9, 5, 9, 19, 9, 9, 20, 9, 15, 9, 9, 7, 9,
+	19, 9, 9, 20, 9, 15, 6, 9, 9, 9, 19, 9, 9, 20, 9, 15, 9, 6, 9, 6, 9, 5, 19, 9,
+	9, 20, 9, 15, 9, 6, 9, 6, 9, 19, 9, 9, 20, 9, 15, 9, 9, 6, 9, 5, 19, 9, 9, 20,
+	9, 15, 9, 6, 9, 9, 19, 9, 9, 20, 9, 15, 9, 9, 6, 9, 19, 9, 9, 20, 9, 15, 9, 9,
+	9, 19, 9, 9, 20, 9, 9, 7, 15, 15, 6, 9, 9, 19, 19, 9, 9, 20, 9, 9, 7, 15, 15, 9,
+	9, 19, 19, 9, 9, 20, 14, 9, 15, 9, 6, 9, 18, 7, 19, 9, 9, 9, 20, 14, 9, 15, 9, 9,
+	18, 7, 19, 9, 9, 9, 20, 9, 9, 15, 9, 7, 9, 5, 19, 7, 9, 9, 20, 9, 9, 7, 13, 9,
+	7, 9, 7, 17, 9, 9, 20, 6, 9, 9, 15, 15, 6, 9, 9, 19, 19, 9, 9, 20, 6, 9, 9, 15,
+	15, 9, 9, 19, 19, 9, 9, 20, 9, 13, 9, 15, 9, 6, 9, 5, 17, 19, 9, 9, 20, 9, 13, 9,
+	15, 6, 9, 9, 17, 19, 9, 9, 20, 6, 9, 9, 15, 9, 7, 9, 5, 19, 9, 9, 20, 9, 13, 9,
+	15, 9, 9, 17, 19, 9, 9, 20, 9, 15, 9, 15, 6, 9, 19, 19, 9, 7, 9, 9, 20, 6, 9, 15,
+	9, 6, 9, 7, 19, 9, 9, 9, 20, 6, 9, 15, 9, 15, 6, 9, 19, 19, 9, 9, 9, 20, 6, 9,
+	15, 9, 6, 9, 5, 19, 9, 9, 9, 20, 6, 9, 15, 9, 9, 7, 19, 9, 9, 9, 20, 6, 9, 15,
+	6, 9, 9, 19, 9, 9, 9, 20, 6, 9, 9, 9, 7, 15, 7, 9, 5, 19, 9, 9, 20, 9, 13, 9,
+	9, 7, 9, 7, 17, 9, 9, 20, 9, 9, 7, 15, 9, 7, 9, 5, 19, 9, 9, 20, 6, 9, 15, 9,
+	6, 9, 19, 9, 9, 9, 20, 9, 15, 9, 9, 19, 9, 7, 9, 9, 20, 6, 9, 15, 9, 9, 19, 9,
+	9, 9, 20, 9, 9, 9, 15, 7, 13, 9, 5, 9, 19, 9, 17, 20, 9, 9, 7, 15, 6, 9, 7, 9,
+	19, 9, 9, 20, 6, 9, 9, 15, 9, 15, 9, 5, 17, 19, 9, 18, 9, 20, 6, 9, 9, 15, 6, 9,
+	5, 9, 9, 19, 5, 9, 20, 6, 9, 9, 15, 9, 7, 9, 9, 19, 5, 9, 20, 6, 9, 9, 15, 9,
+	5, 9, 9, 19, 5, 9, 20, 9, 9, 9, 15, 7, 13, 9, 5, 9, 17, 19, 9, 20, 6, 9, 9, 15,
+	6, 9, 7, 9, 19, 9, 9, 20, 6, 9, 9, 15, 9, 15, 9, 5, 19, 19, 9, 9, 20, 6, 9, 9,
+	15, 6, 9, 5, 9, 19, 9, 9, 20, 6, 9, 9, 15, 9, 7, 9, 19, 9, 9, 20, 6, 9, 9, 15,
+	9, 5, 9, 19, 9, 9, 20, 14, 9, 9, 15, 6, 9, 18, 7, 19, 9, 9, 9, 20, 14, 9, 9, 6,
+	13, 9, 7, 19, 9, 9, 9, 20, 9, 9, 7, 15, 9, 15, 9, 5, 19, 19, 9, 9, 20, 9, 9, 7,
+	15, 6, 9, 5, 9, 19, 9, 9, 20, 14, 9, 9, 13, 9, 7, 19, 9, 9, 9, 20, 9, 9, 7, 13,
+	9, 5, 9, 17, 9, 9, 20, 6, 9, 9, 9, 7, 15, 7, 9, 19, 9, 9, 20, 9, 6, 9, 5, 9,
+	7, 9, 7, 9, 9, 20, 9, 9, 7, 15, 9, 7, 9, 19, 9, 9, 20, 9, 13, 9, 9, 7, 9, 17,
+	9, 9, 20, 6, 9, 6, 9, 5, 9, 9, 7, 9, 9, 20, 6, 9, 6, 9, 7, 9, 9, 9, 9, 20,
+	9, 9, 9, 15, 7, 13, 9, 9, 19, 9, 17, 20, 6, 9, 9, 9, 13, 15, 9, 9, 19, 9, 17, 20,
+	6, 9, 9, 15, 9, 6, 9, 5, 9, 19, 5, 9, 20, 6, 9, 9, 15, 6, 9, 9, 9, 19, 5, 9,
+	20, 6, 9, 9, 9, 13, 9, 7, 9, 5, 9, 17, 20, 9, 9, 7, 9, 7, 9, 7, 9, 9, 20, 9,
+	9, 9, 15, 7, 9, 5, 9, 5, 19, 9, 20, 6, 9, 9, 9, 13, 15, 9, 9, 17, 19, 9, 20, 6,
+	9, 9, 15, 9, 6, 9, 5, 19, 9, 9, 20, 6, 9, 9, 15, 6, 9, 9, 19, 9, 9, 20, 6, 9,
+	9, 15, 9, 6, 9, 19, 9, 9, 20, 6, 9, 9, 15, 9, 9, 19, 9, 9, 20, 9, 9, 9, 15, 7,
+	9, 5, 19, 7, 9, 9, 20, 9, 13, 9, 9, 6, 9, 7, 17, 9, 9, 20, 9, 9, 7, 15, 9, 6,
+	9, 5, 19, 9, 9, 20, 9, 9, 7, 15, 6, 9, 9, 19, 9, 9, 20, 9, 9, 7, 9, 5, 9, 7,
+	9, 9, 20, 9, 9, 7, 9, 5, 9, 5, 9, 9, 20, 6, 9, 9, 9, 7, 9, 15, 9, 5, 19, 9,
+	20, 6, 9, 9, 9, 7, 9, 7, 9, 9, 20, 9, 9, 7, 15, 9, 6, 9, 19, 9, 9, 20, 6, 9,
+	9, 9, 7, 9, 5, 9, 9, 20, 6, 9, 6, 9, 9, 9, 7, 9, 9, 20, 9, 13, 9, 9, 9, 17,
+	9, 9, 20, 9, 6, 9, 15, 15, 6, 9, 9, 19, 9, 19, 9, 20, 9, 6, 9, 15, 15, 9, 9, 19,
+	9, 19, 9, 20, 9, 6, 9, 13, 15, 9, 6, 9, 5, 17, 9, 19, 9, 20, 9, 6, 9, 13, 15, 6,
+	9, 9, 17, 9, 19, 9, 20, 9, 6, 9, 15, 9, 7, 9, 5, 9, 19, 9, 20, 9, 6, 9, 13, 15,
+	9, 9, 17, 9, 19, 9, 20, 9, 9, 15, 15, 6, 9, 9, 18, 19, 9, 9, 17, 20, 9, 9, 15, 15,
+	9, 9, 18, 19, 9, 9, 17, 20, 9, 9, 13, 15, 9, 6, 9, 5, 19, 9, 9, 17, 20, 9, 9, 13,
+	15, 6, 9, 9, 19, 9, 9, 17, 20, 9, 9, 13, 15, 9, 6, 9, 19, 9, 9, 17, 20, 9, 9, 13,
+	15, 9, 9, 19, 9, 9, 17, 20, 9, 6, 9, 7, 9, 15, 15, 9, 5, 19, 9, 19, 9, 20, 9, 15,
+	9, 6, 9, 7, 9, 19, 7, 9, 9, 20, 9, 15, 9, 9, 15, 9, 5, 19, 19, 7, 9, 9, 20, 9,
+	15, 9, 6, 9, 5, 9, 19, 7, 9, 9, 20, 9, 15, 9, 9, 7, 9, 19, 7, 9, 9, 20, 9, 15,
+	6, 9, 9, 9, 19, 7, 9, 9, 20, 9, 14, 9, 9, 13, 7, 9, 5, 9, 19, 9, 20, 9, 9, 13,
+	9, 7, 9, 7, 9, 9, 17, 20, 9, 15, 9, 9, 6, 9, 5, 19, 7, 9, 9, 20, 9, 9, 13, 9,
+	7, 9, 5, 9, 9, 17, 20, 9, 9, 13, 9, 5, 9, 7, 9, 9, 17, 20, 9, 15, 9, 9, 9, 19,
+	7, 9, 9, 20, 9, 9, 15, 15, 6, 9, 9, 19, 9, 19, 9, 20, 9, 9, 15, 15, 9, 9, 19, 9,
+	19, 9, 20, 9, 9, 13, 15, 9, 6, 9, 5, 17, 9, 19, 9, 20, 9, 9, 13, 15, 6, 9, 9, 17,
+	9, 19, 9, 20, 9, 9, 15, 9, 7, 9, 5, 9, 19, 9, 20, 9, 9, 13, 15, 9, 9, 17, 9, 19,
+	9, 20, 9, 6, 9, 15, 15, 6, 9, 9, 19, 19, 9, 9, 20, 9, 6, 9, 15, 15, 9, 9, 19, 19,
+	9, 9, 20, 9, 9, 13, 15, 9, 6, 9, 5, 19, 9, 17, 9, 20, 9, 9, 13, 15, 6, 9, 9, 19,
+	9, 17, 9, 20, 9, 6, 9, 15, 9, 7, 9, 5, 19, 9, 9, 20, 9, 9, 13, 15, 9, 9, 19, 9,
+	17, 9, 20, 9, 6, 9, 5, 9, 15, 15, 9, 5, 19, 9, 19, 9, 20, 9, 15, 9, 6, 9, 7, 9,
+	19, 5, 9, 9, 20, 9, 15, 9, 9, 15, 9, 5, 19, 19, 5, 9, 9, 20, 9, 15, 9, 6, 9, 5,
+	9, 19, 5, 9, 9, 20, 9, 15, 9, 9, 7, 9, 19, 5, 9, 9, 20, 9, 15, 6, 9, 9, 9, 19,
+	5, 9, 9, 20, 9, 6, 9, 9, 15, 7, 9, 5, 9, 19, 9, 20, 9, 9, 13, 9, 7, 9, 7, 9,
+	17, 9, 20, 9, 9, 9, 7, 15, 7, 9, 5, 9, 19, 9, 20, 9, 9, 13, 9, 7, 9, 5, 9, 17,
+	9, 20, 9, 9, 13, 9, 5, 9, 7, 9, 17, 9, 20, 9, 6, 9, 7, 9, 7, 9, 9, 9, 20, 9,
+	9, 6, 15, 15, 6, 9, 9, 19, 19, 9, 9, 20, 9, 9, 6, 15, 15, 9, 9, 19, 19, 9, 9, 20,
+	9, 14, 15, 9, 6, 9, 18, 7, 19, 9, 9, 9, 20, 9, 14, 15, 9, 9, 18, 7, 19, 9, 9, 9,
+	20, 9, 9, 15, 9, 7, 9, 5, 9, 19, 5, 9, 20, 9, 6, 9, 13, 15, 9, 9, 19, 9, 9, 17,
+	20, 9, 9, 15, 15, 6, 9, 9, 19, 19, 9, 9, 20, 9, 9, 15, 15, 9, 9, 19, 19, 9, 9, 20,
+	9, 9, 13, 15, 9, 6, 9, 5, 17, 19, 9, 9, 20, 9, 9, 13, 15, 6, 9, 9, 17, 19, 9, 9,
+	20, 9, 9, 15, 9, 7, 9, 5, 19, 9, 9, 20, 9, 9, 13, 15, 9, 9, 17, 19, 9, 9, 20, 9,
+	15, 9, 6, 15, 6, 9, 19, 19, 9, 9, 9, 20, 9, 15, 9, 6, 9, 7, 19, 9, 9, 9, 20, 9,
+	15, 9, 15, 6, 9, 19, 19, 9, 9, 9, 20, 9, 15, 9, 6, 9, 5, 19, 9, 9, 9, 20, 9, 15,
+	9, 9, 7, 19, 9, 9, 9, 20, 9, 15, 6, 9, 9, 19, 9, 9, 9, 20, 9, 9, 9, 7, 15, 7,
+	9, 5, 19, 9, 9, 20, 9, 9, 13, 9, 7, 9, 7, 17, 9, 9, 20, 9, 6, 9, 9, 15, 7, 9,
+	5, 19, 9, 9, 20, 9, 15, 9, 6, 9, 19, 9, 9, 9, 20, 9, 15, 9, 9, 6, 19, 9, 9, 9,
+	20, 9, 15, 9, 9, 19, 9, 9, 9, 20, 9, 9, 7, 9, 15, 15, 9, 5, 19, 9, 19, 9, 20, 6,
+	9, 9, 15, 6, 9, 7, 9, 19, 7, 9, 9, 20, 9, 9, 9, 15, 7, 13, 9, 5, 19, 9, 9, 17,
+	20, 9, 9, 7, 15, 6, 9, 7, 19, 9, 9, 9, 20, 6, 9, 9, 15, 9, 7, 9, 19, 7, 9, 9,
+	20, 6, 9, 9, 15, 9, 5, 9, 19, 7, 9, 9, 20, 6, 9, 9, 9, 15, 15, 9, 5, 19, 9, 19,
+	9, 20, 9, 9, 15, 6, 9, 7, 19, 7, 9, 9, 9, 20, 9, 9, 7, 9, 15, 15, 9, 5, 19, 19,
+	9, 9, 20, 9, 9, 7, 15, 6, 9, 5, 19, 9, 9, 9, 20, 9, 9, 15, 9, 7, 19, 7, 9, 9,
+	9, 20, 9, 9, 7, 13, 9, 7, 17, 9, 9, 9, 20, 6, 9, 9, 9, 6, 15, 15, 9, 5, 19, 19,
+	9, 9, 20, 6, 9, 9, 15, 6, 9, 7, 19, 9, 9, 9, 20, 6, 9, 9, 9, 15, 15, 9, 5, 19,
+	19, 9, 9, 20, 6, 9, 9, 15, 6, 9, 5, 19, 9, 9, 9, 20, 6, 9, 9, 15, 9, 7, 19, 9,
+	9, 9, 20, 6, 9, 9, 15, 9, 5, 19, 9, 9, 9, 20, 9, 6, 9, 5, 9, 7, 9, 6, 9, 5,
+	9, 20, 9, 6, 9, 5, 9, 7, 9, 6, 9, 9, 20, 6, 9, 6, 9, 5, 9, 9, 6, 9, 5, 9,
+	20, 9, 6, 9, 5, 9, 7, 9, 9, 9, 20, 6, 9, 6, 9, 5, 9, 9, 6, 9, 9, 20, 6, 9,
+	6, 9, 5, 9, 9, 9, 9, 20, 9, 9, 6, 9, 15, 7, 9, 5, 9, 19, 9, 20, 9, 9, 7, 9,
+	15, 9, 5, 9, 19, 9, 20, 9, 9, 9, 15, 7, 9, 5, 18, 9, 9, 17, 20, 9, 9, 9, 13, 7,
+	9, 5, 9, 9, 17, 20, 6, 9, 9, 9, 13, 9, 7, 9, 9, 17, 20, 9, 9, 7, 9, 7, 9, 6,
+	9, 9, 20, 9, 9, 9, 15, 7, 9, 5, 9, 19, 9, 20, 6, 9, 9, 9, 15, 9, 5, 9, 19, 9,
+	20, 9, 9, 6, 9, 15, 7, 9, 5, 19, 9, 9, 20, 9, 9, 7, 9, 15, 9, 5, 19, 9, 9, 20,
+	6, 9, 9, 9, 13, 9, 7, 9, 17, 9, 20, 9, 9, 7, 9, 7, 9, 9, 9, 20, 9, 9, 9, 6,
+	15, 7, 9, 5, 19, 9, 9, 20, 9, 9, 9, 13, 7, 9, 7, 17, 9, 9, 20, 9, 9, 9, 15, 7,
+	9, 5, 19, 9, 9, 20, 6, 9, 9, 9, 15, 9, 5, 19, 9, 9, 20, 9, 9, 7, 9, 5, 9, 6,
+	9, 9, 20, 9, 9, 7, 9, 5, 9, 9, 9, 20, 6, 9, 9, 9, 7, 9, 6, 9, 5, 9, 20, 6,
+	9, 9, 9, 7, 9, 6, 9, 9, 20, 6, 9, 6, 9, 9, 9, 6, 9, 5, 9, 20, 6, 9, 9, 9,
+	7, 9, 9, 9, 20, 6, 9, 6, 9, 9, 9, 6, 9, 9, 20, 6, 9, 6, 9, 9, 9, 9, 9, 20,
+	9, 9, 15, 9, 6, 13, 9, 5, 9, 19, 9, 17, 20, 9, 6, 9, 15, 6, 9, 7, 9, 9, 19, 9,
+	20, 9, 6, 9, 15, 9, 15, 9, 5, 19, 9, 19, 9, 20, 9, 6, 9, 15, 6, 9, 5, 9, 9, 19,
+	9, 20, 9, 6, 9, 15, 9, 7, 9, 9, 19, 9, 20, 9, 6, 9, 15, 9, 5, 9, 9, 19, 9, 20,
+	9, 9, 13, 9, 15, 6, 9, 5, 9, 19, 9, 17, 20, 9, 9, 13, 9, 15, 9, 5, 9, 19, 9, 17,
+	20, 9, 9, 15, 9, 6, 13, 9, 5, 19, 9, 9, 17, 20, 9, 9, 15, 6, 9, 5, 9, 18, 9, 9,
+	17, 20, 9, 9, 15, 9, 7, 9, 18, 9, 9, 17, 20, 9, 9, 6, 13, 9, 7, 9, 9, 9, 17, 20,
+	9, 14, 9, 9, 13, 15, 9, 5, 19, 9, 19, 9, 20, 9, 9, 15, 6, 9, 7, 18, 9, 9, 9, 17,
+	20, 9, 9, 13, 9, 15, 6, 9, 5, 19, 9, 9, 17, 20, 9, 9, 13, 9, 15, 9, 5, 19, 9, 9,
+	17, 20, 9, 9, 15, 9, 7, 18, 9, 9, 9, 17, 20, 9, 9, 6, 13, 9, 5, 9, 9, 9, 17, 20,
+	9, 14, 9, 9, 13, 7, 9, 9, 19, 9, 20, 9, 6, 9, 7, 9, 15, 9, 9, 19, 9, 20, 9, 6,
+	9, 9, 15, 7, 9, 18, 9, 9, 17, 20, 9, 9, 13, 9, 7, 9, 9, 9, 17, 20, 9, 9, 13, 9,
+	5, 9, 6, 9, 9, 17, 20, 9, 9, 13, 9, 5, 9, 9, 9, 17, 20, 9, 9, 14, 15, 6, 9, 5,
+	9, 18, 9, 19, 9, 20, 9, 9, 15, 6, 9, 7, 9, 9, 19, 9, 20, 9, 9, 15, 9, 15, 9, 5,
+	19, 9, 19, 9, 20, 9, 9, 15, 6, 9, 5, 9, 9, 19, 9, 20, 9, 9, 15, 9, 7, 9, 9, 19,
+	9, 20, 9, 9, 15, 9, 5, 9, 9, 19, 9, 20, 9, 9, 13, 9, 15, 6, 9, 5, 9, 17, 19, 9,
+	20, 9, 6, 9, 15, 6, 9, 7, 9, 19, 9, 9, 20, 9, 6, 9, 15, 9, 15, 9, 5, 19, 19, 9,
+	9, 20, 9, 6, 9, 15, 6, 9, 5, 9, 19, 9, 9, 20, 9, 6, 9, 15, 9, 7, 9, 19, 9, 9,
+	20, 9, 6, 9, 15, 9, 5, 9, 19, 9, 9, 20, 9, 6, 9, 9, 15, 15, 9, 5, 19, 9, 19, 9,
+	20, 9, 9, 6, 15, 6, 9, 5, 9, 9, 19, 9, 20, 9, 9, 9, 7, 15, 15, 9, 5, 19, 9, 19,
+	9, 20, 9, 9, 13, 9, 15, 9, 5, 19, 9, 17, 9, 20, 9, 9, 15, 9, 7, 18, 9, 9, 17, 9,
+	20, 9, 9, 6, 13, 9, 5, 9, 9, 17, 9, 20, 9, 6, 9, 9, 15, 7, 9, 9, 19, 9, 20, 9,
+	6, 9, 5, 9, 15, 9, 9, 19, 9, 20, 9, 9, 9, 7, 15, 7, 9, 9, 19, 9, 20, 9, 9, 13,
+	9, 7, 9, 9, 17, 9, 20, 9, 6, 9, 5, 9, 9, 7, 9, 5, 9, 20, 9, 6, 9, 7, 9, 6,
+	9, 9, 9, 20, 9, 9, 9, 13, 15, 6, 9, 5, 9, 19, 9, 17, 20, 9, 9, 6, 15, 6, 9, 7,
+	9, 19, 9, 9, 20, 9, 9, 15, 9, 15, 9, 5, 17, 19, 9, 18, 9, 20, 9, 9, 15, 6, 9, 5,
+	9, 9, 19, 5, 9, 20, 9, 9, 15, 9, 7, 9, 9, 19, 5, 9, 20, 9, 9, 15, 9, 5, 9, 9,
+	19, 5, 9, 20, 9, 9, 9, 13, 15, 6, 9, 5, 9, 17, 19, 9, 20, 9, 9, 15, 6, 9, 7, 9,
+	19, 9, 9, 20, 9, 9, 15, 9, 15, 9, 5, 19, 19, 9, 9, 20, 9, 9, 15, 6, 9, 5, 9, 19,
+	9, 9, 20, 9, 9, 15, 9, 7, 9, 19, 9, 9, 20, 9, 9, 15, 9, 5, 9, 19, 9, 9, 20, 9,
+	9, 9, 7, 15, 15, 9, 5, 19, 19, 9, 9, 20, 9, 6, 9, 15, 6, 9, 7, 19, 9, 9, 9, 20,
+	9, 6, 9, 9, 15, 15, 9, 5, 19, 19, 9, 9, 20, 9, 6, 9, 15, 6, 9, 5, 19, 9, 9, 9,
+	20, 9, 6, 9, 15, 9, 7, 19, 9, 9, 9, 20, 9, 6, 9, 15, 9, 5, 19, 9, 9, 9, 20, 9,
+	9, 9, 7, 15, 7, 9, 19, 9, 9, 20, 9, 6, 9, 5, 9, 6, 9, 7, 9, 9, 20, 9, 6, 9,
+	9, 15, 7, 9, 19, 9, 9, 20, 9, 9, 13, 9, 7, 9, 17, 9, 9, 20, 9, 6, 9, 5, 9, 9,
+	7, 9, 9, 20, 9, 6, 9, 7, 9, 9, 9, 9, 20, 9, 9, 6, 9, 15, 15, 9, 5, 19, 9, 19,
+	9, 20, 9, 9, 15, 6, 9, 7, 9, 19, 7, 9, 9, 20, 9, 9, 9, 13, 15, 6, 9, 5, 19, 9,
+	9, 17, 20, 9, 9, 6, 15, 6, 9, 7, 19, 9, 9, 9, 20, 9, 9, 15, 9, 7, 9, 19, 7, 9,
+	9, 20, 9, 9, 15, 9, 5, 9, 19, 7, 9, 9, 20, 9, 9, 9, 15, 15, 9, 5, 19, 9, 19, 9,
+	20, 9, 9, 9, 13, 15, 9, 5, 17, 9, 19, 9, 20, 9, 9, 6, 9, 15, 15, 9, 5, 19, 19, 9,
+	9, 20, 9, 9, 6, 15, 6, 9, 5, 19, 9, 9, 9, 20, 9, 9, 15, 9, 7, 9, 19, 5, 9, 9,
+	20, 9, 9, 6, 13, 9, 7, 17, 9, 9, 9, 20, 9, 9, 9, 6, 15, 15, 9, 5, 19, 19, 9, 9,
+	20, 9, 9, 15, 6, 9, 7, 19, 9, 9, 9, 20, 9, 9, 9, 15, 15, 9, 5, 19, 19, 9, 9, 20,
+	9, 9, 15, 6, 9, 5, 19, 9, 9, 9, 20, 9, 9, 15, 9, 7, 19, 9, 9, 9, 20, 9, 9, 15,
+	9, 5, 19, 9, 9, 9, 20, 9, 6, 9, 5, 9, 6, 9, 6, 9, 5, 9, 20, 9, 6, 9, 5, 9,
+	6, 9, 6, 9, 9, 20, 9, 6, 9, 5, 9, 9, 6, 9, 5, 9, 20, 9, 6, 9, 5, 9, 6, 9,
+	9, 9, 20, 9, 6, 9, 5, 9, 9, 6, 9, 9, 20, 9, 6, 9, 5, 9, 9, 9, 9, 20, 9, 9,
+	6, 9, 15, 7, 9, 9, 19, 9, 20, 9, 9, 7, 9, 15, 9, 9, 19, 9, 20, 9, 9, 9, 15, 7,
+	9, 18, 9, 9, 17, 20, 9, 9, 7, 9, 6, 9, 7, 9, 9, 20, 6, 9, 9, 9, 9, 7, 9, 5,
+	9, 5, 20, 6, 9, 9, 9, 13, 9, 9, 9, 17, 20, 9, 9, 9, 15, 7, 9, 9, 19, 9, 20, 6,
+	9, 9, 9, 15, 9, 9, 19, 9, 20, 9, 9, 6, 9, 15, 7, 9, 19, 9, 9, 20, 9, 9, 7, 9,
+	6, 9, 5, 9, 9, 20, 6, 9, 9, 9, 9, 7, 9, 5, 9, 20, 9, 9, 7, 9, 6, 9, 9, 9,
+	20, 9, 9, 9, 6, 15, 7, 9, 19, 9, 9, 20, 6, 9, 9, 9, 6, 9, 7, 9, 9, 20, 9, 9,
+	9, 15, 7, 9, 19, 9, 9, 20, 6, 9, 9, 9, 6, 9, 5, 9, 9, 20, 6, 9, 9, 9, 9, 7,
+	9, 9, 20, 9, 9, 7, 9, 9, 9, 9, 20, 6, 9, 9, 9, 6, 9, 6, 9, 5, 9, 20, 6, 9,
+	9, 9, 6, 9, 6, 9, 9, 20, 6, 9, 9, 9, 9, 6, 9, 5, 9, 20, 6, 9, 9, 9, 6, 9,
+	9, 9, 20, 6, 9, 9, 9, 9, 6, 9, 9, 20, 6, 9, 9, 9, 9, 9, 9, 20, 9, 9, 15, 9,
+	6, 13, 9, 9, 19, 9, 17, 20, 9, 9, 15, 9, 13, 9, 9, 19, 9, 17, 20, 9, 6, 9, 15, 9,
+	6, 9, 5, 9, 19, 9, 20, 9, 6, 9, 15, 6, 9, 9, 9, 19, 9, 20, 9, 6, 9, 15, 9, 6,
+	9, 9, 19, 9, 20, 9, 6, 9, 15, 9, 9, 9, 19, 9, 20, 9, 9, 13, 9, 15, 6, 9, 9, 19,
+	9, 17, 20, 9, 9, 13, 9, 15, 9, 9, 19, 9, 17, 20, 9, 9, 15, 9, 6, 9, 5, 18, 9, 9,
+	17, 20, 9, 9, 15, 6, 9, 9, 18, 9, 9, 17, 20, 9, 9, 13, 9, 9, 7, 9, 5, 9, 17, 20,
+	9, 9, 15, 9, 9, 18, 9, 9, 17, 20, 9, 14, 9, 9, 6, 13, 9, 5, 9, 19, 9, 20, 9, 9,
+	9, 7, 13, 9, 7, 9, 9, 17, 20, 9, 9, 13, 9, 9, 15, 9, 5, 19, 9, 17, 20, 9, 9, 9,
+	7, 13, 9, 5, 9, 9, 17, 20, 9, 9, 13, 9, 9, 7, 9, 9, 17, 20, 9, 9, 6, 13, 9, 9,
+	9, 9, 17, 20, 9, 14, 9, 9, 6, 13, 9, 9, 19, 9, 20, 9, 14, 9, 9, 13, 9, 9, 19, 9,
+	20, 9, 9, 13, 9, 9, 6, 9, 5, 9, 17, 20, 9, 9, 9, 7, 13, 9, 9, 9, 17, 20, 9, 9,
+	13, 9, 9, 6, 9, 9, 17, 20, 9, 9, 13, 9, 9, 9, 9, 17, 20, 9, 9, 14, 15, 6, 9, 9,
+	18, 9, 19, 9, 20, 9, 9, 14, 15, 9, 9, 18, 9, 19, 9, 20, 9, 9, 15, 9, 6, 9, 5, 9,
+	19, 9, 20, 9, 9, 15, 6, 9, 9, 9, 19, 9, 20, 9, 9, 15, 9, 6, 9, 9, 19, 9, 20, 9,
+	9, 15, 9, 9, 9, 19, 9, 20, 9, 9, 13, 9, 15, 6, 9, 9, 17, 19, 9, 20, 9, 9, 13, 9,
+	15, 9, 9, 17, 19, 9, 20, 9, 6, 9, 15, 9, 6, 9, 5, 19, 9, 9, 20, 9, 6, 9, 15, 6,
+	9, 9, 19, 9, 9, 20, 9, 6, 9, 15, 9, 6, 9, 19, 9, 9, 20, 9, 6, 9, 15, 9, 9, 19,
+	9, 9, 20, 9, 6, 9, 9, 15, 6, 9, 5, 9, 19, 9, 20, 9, 6, 9, 9, 15, 9, 5, 9, 19,
+	9, 20, 9, 9, 9, 7, 15, 6, 9, 5, 9, 19, 9, 20, 9, 9, 9, 7, 13, 9, 5, 9, 17, 9,
+	20, 9, 9, 13, 9, 9, 7, 9, 17, 9, 20, 9, 6, 9, 6, 9, 7, 9, 9, 9, 20, 9, 6, 9,
+	9, 15, 6, 9, 9, 19, 9, 20, 9, 6, 9, 9, 15, 9, 9, 19, 9, 20, 9, 9, 9, 7, 15, 6,
+	9, 9, 19, 9, 20, 9, 9, 9, 7, 9, 5, 9, 5, 9, 20, 9, 6, 9, 9, 9, 7, 9, 5, 9,
+	20, 9, 9, 13, 9, 9, 9, 17, 9, 20, 9, 9, 9, 13, 15, 6, 9, 9, 19, 9, 17, 20, 9, 9,
+	9, 13, 15, 9, 9, 19, 9, 17, 20, 9, 9, 15, 9, 6, 9, 5, 9, 19, 5, 9, 20, 9, 9, 15,
+	6, 9, 9, 9, 19, 5, 9, 20, 9, 9, 9, 13, 9, 7, 9, 5, 9, 17, 20, 9, 9, 6, 9, 7,
+	9, 7, 9, 9, 20, 9, 9, 9, 13, 15, 6, 9, 9, 17, 19, 9, 20, 9, 9, 9, 13, 15, 9, 9,
+	17, 19, 9, 20, 9, 9, 15, 9, 6, 9, 5, 19, 9, 9, 20, 9, 9, 15, 6, 9, 9, 19, 9, 9,
+	20, 9, 9, 15, 9, 6, 9, 19, 9, 9, 20, 9, 9, 15, 9, 9, 19, 9, 9, 20, 9, 9, 9, 7,
+	15, 6, 9, 5, 19, 9, 9, 20, 9, 9, 9, 7, 13, 9, 7, 17, 9, 9, 20, 9, 6, 9, 9, 15,
+	6, 9, 5, 19, 9, 9, 20, 9, 6, 9, 9, 15, 9, 5, 19, 9, 9, 20, 9, 9, 6, 9, 5, 9,
+	7, 9, 9, 20, 9, 6, 9, 6, 9, 5, 9, 9, 9, 20, 9, 9, 9, 7, 9, 15, 9, 5, 19, 9,
+	20, 9, 9, 9, 7, 9, 7, 9, 9, 20, 9, 6, 9, 9, 9, 15, 9, 5, 19, 9, 20, 9, 9, 9,
+	7, 9, 5, 9, 9, 20, 9, 6, 9, 9, 9, 7, 9, 9, 20, 9, 6, 9, 6, 9, 9, 9, 9, 20,
+	9, 9, 6, 9, 15, 6, 9, 5, 9, 19, 9, 20, 9, 9, 6, 9, 15, 9, 5, 9, 19, 9, 20, 9,
+	9, 9, 13, 9, 15, 9, 5, 19, 9, 17, 20, 9, 9, 9, 6, 13, 9, 5, 9, 9, 17, 20, 9, 9,
+	9, 13, 9, 7, 9, 9, 17, 20, 9, 9, 6, 9, 7, 9, 6, 9, 9, 20, 9, 9, 9, 15, 6, 9,
+	5, 9, 19, 9, 20, 9, 9, 9, 15, 9, 5, 9, 19, 9, 20, 9, 9, 6, 9, 15, 6, 9, 5, 19,
+	9, 9, 20, 9, 9, 6, 9, 15, 9, 5, 19, 9, 9, 20, 9, 9, 9, 13, 9, 7, 9, 17, 9, 20,
+	9, 9, 6, 9, 7, 9, 9, 9, 20, 9, 9, 9, 6, 15, 6, 9, 5, 19, 9, 9, 20, 9, 9, 9,
+	6, 13, 9, 7, 17, 9, 9, 20, 9, 9, 9, 15, 6, 9, 5, 19, 9, 9, 20, 9, 9, 9, 15, 9,
+	5, 19, 9, 9, 20, 9, 9, 6, 9, 5, 9, 6, 9, 9, 20, 9, 9, 6, 9, 5, 9, 9, 9, 20,
+	9, 9, 9, 7, 9, 6, 9, 5, 9, 20, 9, 9, 9, 7, 9, 6, 9, 9, 20, 9, 6, 9, 9, 9,
+	6, 9, 5, 9, 20, 9, 9, 9, 7, 9, 9, 9, 20, 9, 6, 9, 9, 9, 6, 9, 9, 20, 9, 6,
+	9, 9, 9, 9, 9, 20, 9, 9, 6, 9, 15, 6, 9, 9, 19, 9, 20, 9, 9, 6, 9, 15, 9, 9,
+	19, 9, 20, 9, 9, 9, 9, 7, 13, 9, 5, 9, 17, 20, 9, 9, 6, 9, 6, 9, 7, 9, 9, 20,
+	9, 9, 9, 9, 7, 9, 5, 9, 5, 20, 9, 9, 9, 13, 9, 9, 9, 17, 20, 9, 9, 9, 15, 6,
+	9, 9, 19, 9, 20, 9, 9, 9, 15, 9, 9, 19, 9, 20, 9, 9, 6, 9, 9, 15, 9, 5, 19, 9,
+	20, 9, 9, 6, 9, 6, 9, 5, 9, 9, 20, 9, 9, 9, 9, 7, 9, 5, 9, 20, 9, 9, 6, 9,
+	6, 9, 9, 9, 20, 9, 9, 9, 6, 9, 15, 9, 5, 19, 9, 20, 9, 9, 9, 6, 9, 7, 9, 9,
+	20, 9, 9, 9, 9, 15, 9, 5, 19, 9, 20, 9, 9, 9, 6, 9, 5, 9, 9, 20, 9, 9, 9, 9,
+	7, 9, 9, 20, 9, 9, 6, 9, 9, 9, 9, 20, 9, 9, 9, 6, 9, 6, 9, 5, 9, 20, 9, 9,
+	9, 6, 9, 6, 9, 9, 20, 9, 9, 9, 9, 6, 9, 5, 9, 20, 9, 9, 9, 6, 9, 9, 9, 20,
+	9, 9, 9, 9, 6, 9, 9, 20, 9, 9, 9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 18, 9, 9, 9,
+	9, 9, 9, 20, 18, 18, 18, 18, 18, 9, 18, 9, 9, 9, 9, 9, 20, 18, 18, 18, 18, 9, 18, 18,
+	9, 5, 9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 9, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 18,
+	9, 18, 18, 9, 9, 9, 9, 9, 20, 18, 18, 18, 18, 9, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18,
+	18, 18, 6, 18, 18, 9, 9, 9, 9, 9, 9, 20, 18, 18, 18, 18, 6, 18, 9, 18, 9, 9, 9, 9,
+	9, 20, 18, 18, 18, 18, 9, 18, 18, 9, 7, 9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 9, 9, 9,
+	18, 9, 9, 9, 20, 18, 18, 18, 18, 9, 9, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 18, 18, 9,
+	18, 9, 9, 18, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18,
+	18, 9, 13, 18, 18, 9, 19, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 18, 9, 7, 9, 9, 9,
+	9, 20, 18, 18, 18, 9, 18, 18, 9, 5, 9, 18, 9, 9, 9, 20, 18, 18, 18, 18, 9, 9, 18, 18,
+	9, 9, 9, 9, 20, 18, 18, 18, 18, 9, 9, 18, 9, 18, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18,
+	18, 9, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9,
+	18, 9, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9, 9, 18, 9, 9, 9, 20, 18,
+	18, 18, 9, 18, 9, 18, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 9, 18, 9, 18, 9, 9, 9,
+	20, 18, 18, 18, 6, 18, 18, 18, 9, 9, 9, 9, 9, 9, 20, 18, 18, 18, 6, 18, 18, 9, 18, 9,
+	9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 18, 9, 9, 9, 7, 9, 9, 9, 20, 18, 18, 18, 6, 18,
+	18, 9, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 6, 18, 9, 18, 18, 9, 9, 9, 9, 9, 20, 18,
+	18, 18, 6, 18, 9, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 18, 9, 5, 9, 7,
+	9, 9, 9, 20, 18, 18, 18, 9, 13, 18, 18, 9, 19, 9, 7, 9, 9, 9, 20, 18, 18, 18, 9, 18,
+	18, 18, 9, 7, 9, 7, 9, 9, 9, 20, 18, 18, 18, 18, 18, 9, 9, 9, 9, 18, 9, 9, 20, 18,
+	18, 18, 18, 9, 9, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 18, 18, 9, 18, 9, 9, 9, 18, 9,
+	9, 20, 18, 18, 18, 9, 18, 6, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9,
+	7, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 18, 9, 7, 9, 6, 9, 9, 9, 20, 18, 18,
+	18, 9, 18, 18, 9, 5, 9, 9, 18, 9, 9, 20, 18, 18, 18, 9, 18, 9, 18, 7, 18, 9, 9, 9,
+	9, 20, 18, 18, 18, 18, 9, 9, 18, 9, 9, 18, 9, 9, 20, 18, 18, 18, 9, 18, 6, 18, 18, 9,
+	9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 6, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18,
+	9, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9, 9, 9, 18, 9, 9, 20, 18, 18,
+	18, 9, 18, 9, 9, 18, 18, 9, 5, 9, 9, 20, 18, 18, 18, 9, 18, 9, 18, 9, 9, 18, 9, 9,
+	20, 18, 18, 9, 13, 18, 18, 18, 18, 9, 9, 17, 9, 9, 9, 20, 18, 18, 9, 13, 18, 18, 18, 9,
+	18, 9, 17, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 7, 9, 5, 9, 9, 9, 20, 18, 18,
+	9, 13, 18, 18, 18, 9, 9, 19, 9, 9, 9, 20, 18, 18, 9, 13, 18, 18, 9, 18, 18, 9, 17, 9,
+	9, 9, 20, 18, 18, 9, 13, 18, 18, 9, 18, 9, 19, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18,
+	9, 5, 9, 7, 9, 9, 9, 20, 18, 18, 9, 13, 18, 18, 18, 9, 19, 9, 7, 9, 9, 9, 20, 18,
+	18, 9, 18, 18, 18, 18, 9, 7, 9, 7, 9, 9, 9, 20, 18, 18, 18, 6, 18, 18, 9, 9, 9, 9,
+	18, 9, 9, 20, 18, 18, 9, 13, 18, 18, 9, 18, 19, 9, 7, 9, 9, 9, 20, 18, 18, 18, 6, 18,
+	9, 18, 9, 9, 9, 18, 9, 9, 20, 18, 18, 18, 9, 18, 6, 18, 18, 9, 7, 9, 9, 9, 9, 20,
+	18, 18, 18, 9, 18, 18, 9, 7, 9, 18, 9, 9, 9, 20, 18, 18, 9, 13, 18, 9, 18, 18, 18, 9,
+	7, 17, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9, 7, 9, 9, 18, 9, 9, 20, 18, 18, 18, 18,
+	9, 9, 9, 18, 18, 9, 9, 9, 20, 18, 18, 18, 18, 9, 9, 9, 18, 9, 18, 9, 9, 20, 18, 18,
+	18, 9, 9, 18, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 9, 13, 18, 9, 18, 18, 9, 19, 9, 9,
+	9, 20, 18, 18, 18, 9, 9, 18, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9,
+	5, 9, 18, 9, 9, 20, 18, 18, 18, 9, 18, 9, 9, 18, 18, 9, 9, 9, 20, 18, 18, 18, 9, 18,
+	9, 9, 18, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18,
+	9, 13, 18, 18, 18, 9, 19, 9, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 7, 9, 9, 9,
+	9, 20, 18, 18, 9, 18, 18, 18, 9, 5, 9, 18, 9, 9, 9, 20, 18, 18, 9, 13, 18, 18, 9, 18,
+	19, 9, 9, 9, 9, 20, 18, 18, 9, 13, 18, 18, 9, 19, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18,
+	18, 6, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 7, 18, 9, 9, 9, 9,
+	20, 18, 18, 9, 18, 18, 18, 18, 9, 7, 9, 6, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 5,
+	9, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 9, 18, 7, 18, 9, 9, 9, 9, 20, 18, 18, 9, 13,
+	18, 18, 9, 19, 9, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 6, 18, 18, 9, 7, 9, 9, 9, 9,
+	20, 18, 18, 9, 18, 18, 18, 9, 7, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 13, 18, 18, 18,
+	9, 7, 17, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 7, 9, 9, 18, 9, 9, 20, 18, 18, 9,
+	18, 18, 9, 5, 9, 18, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 5, 9, 18, 9, 18, 9, 9,
+	20, 18, 18, 18, 9, 9, 18, 18, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9, 18, 9,
+	9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 7, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18,
+	9, 9, 18, 9, 9, 20, 18, 18, 18, 9, 9, 18, 9, 18, 18, 9, 9, 9, 20, 18, 18, 18, 9, 9,
+	18, 9, 18, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 9, 9, 9, 9, 20, 18, 18, 9,
+	18, 18, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 18, 18, 9, 5, 9, 9, 9, 20,
+	18, 18, 9, 18, 18, 18, 9, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 18, 18, 9, 9, 9,
+	9, 20, 18, 18, 9, 18, 18, 9, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18, 6, 18, 18, 9,
+	9, 9, 9, 9, 20, 18, 18, 9, 18, 18, 6, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 9, 18, 18,
+	9, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 9, 9, 18, 9, 9, 20, 18, 18,
+	9, 18, 18, 9, 9, 18, 18, 9, 5, 9, 9, 20, 18, 18, 9, 18, 18, 9, 18, 9, 9, 18, 9, 9,
+	20, 18, 18, 9, 18, 9, 18, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 9, 18, 9, 13, 18, 18, 9,
+	19, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 9, 18, 9,
+	18, 18, 9, 5, 9, 18, 9, 9, 20, 18, 18, 9, 18, 18, 9, 9, 18, 18, 9, 9, 9, 20, 18, 18,
+	9, 18, 18, 9, 9, 18, 9, 18, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 18, 9, 9, 9, 9, 20,
+	18, 18, 9, 18, 9, 18, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 9, 18, 18, 9, 5,
+	9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 9, 18, 9, 9, 20, 18, 18, 9, 18, 9, 18, 9, 18,
+	18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 9, 18, 9, 18, 9, 9, 20, 18, 18, 6, 18, 18, 18,
+	18, 9, 9, 9, 9, 9, 9, 20, 18, 18, 6, 18, 18, 18, 9, 18, 9, 9, 9, 9, 9, 20, 18, 18,
+	6, 18, 18, 9, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18, 6, 18, 18, 18, 9, 9, 18, 9, 9,
+	9, 9, 20, 18, 18, 6, 18, 18, 9, 18, 18, 9, 9, 9, 9, 9, 20, 18, 18, 6, 18, 18, 9, 18,
+	9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 18, 9, 9, 9, 9, 7, 9, 9, 20, 18, 18, 18,
+	18, 18, 9, 18, 9, 9, 9, 7, 9, 9, 20, 18, 18, 6, 18, 18, 9, 18, 18, 9, 7, 9, 9, 9,
+	9, 20, 18, 18, 6, 18, 18, 18, 9, 9, 9, 18, 9, 9, 9, 20, 18, 18, 18, 18, 9, 18, 18, 9,
+	9, 9, 7, 9, 9, 20, 18, 18, 6, 18, 18, 9, 18, 9, 9, 18, 9, 9, 9, 20, 18, 18, 6, 18,
+	9, 18, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18, 6, 18, 9, 13, 18, 18, 9, 19, 9, 9, 9,
+	9, 20, 18, 18, 6, 18, 9, 18, 18, 18, 9, 7, 9, 9, 9, 9, 20, 18, 18, 18, 18, 18, 9, 9,
+	9, 7, 18, 9, 9, 9, 20, 18, 18, 6, 18, 18, 9, 9, 18, 18, 9, 9, 9, 9, 20, 18, 18, 6,
+	18, 18, 9, 9, 18, 9, 18, 9, 9, 9, 20, 18, 18, 6, 18, 9, 18, 18, 18, 9, 9, 9, 9, 9,
+	20, 18, 18, 6, 18, 9, 18, 18, 9, 18, 9, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 18, 9, 9,
+	9, 7, 9, 9, 20, 18, 18, 6, 18, 9, 18, 18, 9, 9, 18, 9, 9, 9, 20, 18, 18, 6, 18, 9,
+	18, 9, 18, 18, 9, 9, 9, 9, 20, 18, 18, 6, 18, 9, 18, 9, 18, 9, 18, 9, 9, 9, 20, 18,
+	18, 18, 6, 18, 18, 18, 9, 9, 9, 9, 6, 9, 9, 20, 18, 18, 18, 6, 18, 18, 9, 18, 9, 9,
+	9, 6, 9, 9, 20, 18, 18, 18, 18, 18, 18, 9, 9, 9, 7, 9, 6, 9, 9, 20, 18, 18, 9, 13,
+	18, 18, 18, 9, 9, 19, 9, 7, 9, 9, 20, 18, 18, 18, 6, 18, 9, 18, 18, 9, 9, 9, 6, 9,
+	9, 20, 18, 18, 9, 13, 18, 18, 9, 18, 9, 19, 9, 7, 9, 9, 20, 18, 18, 18, 18, 9, 13, 18,
+	18, 9, 9, 9, 9, 9, 17, 20, 18, 18, 18, 18, 9, 13, 18, 9, 18, 9, 9, 9, 9, 17, 20, 18,
+	18, 18, 18, 18, 9, 13, 18, 9, 9, 9, 9, 9, 17, 20, 18, 18, 18, 18, 18, 9, 9, 9, 9, 9,
+	18, 9, 20, 18, 18, 18, 18, 9, 9, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 18, 18, 18, 9, 18,
+	9, 9, 9, 9, 18, 9, 20, 18, 18, 18, 9, 18, 6, 18, 18, 9, 5, 9, 9, 6, 9, 9, 20, 18,
+	18, 18, 9, 18, 18, 9, 7, 9, 18, 9, 7, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9, 13, 18, 9,
+	5, 9, 9, 9, 17, 20, 18, 18, 18, 9, 18, 18, 9, 5, 9, 9, 9, 18, 9, 20, 18, 18, 18, 18,
+	9, 9, 9, 18, 18, 9, 7, 9, 9, 20, 18, 18, 18, 18, 9, 9, 18, 9, 9, 9, 18, 9, 20, 18,
+	18, 18, 9, 9, 18, 18, 18, 9, 5, 9, 7, 9, 9, 20, 18, 18, 9, 13, 18, 9, 18, 18, 9, 19,
+	9, 7, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 18, 9, 7, 9, 7, 9, 9, 20, 18, 18, 18, 9,
+	18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 18, 18, 9, 18, 9, 9, 18, 18, 9, 7, 9, 9, 20, 18,
+	18, 18, 9, 18, 9, 18, 9, 9, 9, 18, 9, 20, 18, 18, 18, 6, 18, 18, 18, 9, 9, 9, 9, 7,
+	9, 9, 20, 18, 18, 18, 6, 18, 18, 9, 18, 9, 9, 9, 7, 9, 9, 20, 18, 18, 18, 18, 18, 18,
+	9, 9, 9, 7, 9, 7, 9, 9, 20, 18, 18, 9, 13, 18, 6, 18, 18, 9, 9, 19, 9, 9, 9, 20,
+	18, 18, 9, 18, 18, 9, 7, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 9, 13, 18, 6, 18, 9, 18,
+	9, 19, 9, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 5, 9, 7, 9, 6, 9, 9, 20, 18, 18,
+	9, 13, 18, 18, 18, 9, 19, 9, 7, 9, 6, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 7, 9,
+	7, 9, 6, 9, 9, 20, 18, 18, 18, 6, 18, 18, 9, 9, 9, 9, 9, 18, 9, 20, 18, 18, 18, 18,
+	9, 9, 18, 18, 9, 7, 9, 7, 9, 9, 20, 18, 18, 18, 6, 18, 9, 18, 9, 9, 9, 9, 18, 9,
+	20, 18, 18, 18, 9, 18, 6, 18, 18, 9, 5, 9, 9, 7, 9, 9, 20, 18, 18, 9, 13, 18, 9, 18,
+	18, 9, 7, 19, 9, 9, 9, 20, 18, 18, 18, 9, 18, 18, 9, 13, 18, 9, 7, 9, 9, 9, 17, 20,
+	18, 18, 18, 9, 18, 18, 9, 7, 9, 9, 9, 18, 9, 20, 18, 18, 18, 18, 9, 9, 9, 9, 18, 18,
+	9, 5, 9, 20, 18, 18, 18, 18, 9, 9, 9, 18, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 7,
+	18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9, 7, 18, 9, 9, 9, 20, 18, 18,
+	18, 9, 9, 18, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9, 5, 9, 9,
+	18, 9, 20, 18, 18, 18, 9, 9, 18, 9, 18, 7, 18, 9, 9, 9, 20, 18, 18, 18, 9, 18, 9, 9,
+	18, 9, 9, 18, 9, 20, 18, 18, 9, 18, 6, 18, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 18, 9,
+	13, 18, 6, 18, 18, 9, 19, 9, 9, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 18, 9, 7, 9, 9,
+	9, 9, 20, 18, 18, 9, 13, 18, 18, 18, 9, 19, 9, 9, 7, 9, 9, 20, 18, 18, 9, 18, 18, 9,
+	7, 18, 18, 9, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 18, 9, 18, 9, 9, 9, 20, 18, 18,
+	9, 18, 18, 6, 18, 18, 9, 5, 9, 9, 6, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 7, 9, 18,
+	9, 7, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 13, 18, 9, 5, 9, 9, 9, 17, 20, 18, 18, 9,
+	18, 18, 18, 9, 5, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 18, 9, 5, 9, 18, 18, 9, 7, 9,
+	9, 20, 18, 18, 9, 13, 18, 18, 9, 19, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 18, 6, 18, 18,
+	9, 5, 9, 9, 7, 9, 9, 20, 18, 18, 9, 18, 9, 13, 18, 18, 9, 7, 19, 9, 9, 9, 20, 18,
+	18, 9, 18, 18, 18, 9, 13, 18, 9, 7, 9, 9, 9, 17, 20, 18, 18, 9, 18, 18, 18, 9, 7, 9,
+	9, 9, 18, 9, 20, 18, 18, 18, 18, 9, 9, 9, 18, 7, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18,
+	9, 5, 9, 18, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 7, 18, 18, 9, 9, 9, 9, 20, 18,
+	18, 9, 18, 9, 18, 7, 18, 9, 18, 9, 9, 9, 20, 18, 18, 18, 9, 9, 18, 9, 18, 18, 9, 7,
+	9, 9, 20, 18, 18, 18, 9, 9, 18, 18, 9, 9, 9, 18, 9, 20, 18, 18, 18, 9, 9, 18, 9, 9,
+	18, 18, 9, 5, 9, 20, 18, 18, 18, 9, 9, 18, 9, 18, 9, 9, 18, 9, 20, 18, 18, 9, 18, 6,
+	18, 18, 18, 9, 9, 9, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 18, 9, 9, 9, 9, 20, 18,
+	18, 9, 18, 18, 18, 18, 9, 9, 9, 7, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 9, 18, 9,
+	9, 9, 20, 18, 18, 9, 18, 6, 18, 9, 18, 18, 9, 9, 9, 9, 20, 18, 18, 9, 18, 6, 18, 9,
+	18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 18, 9, 5, 9, 7, 9, 9, 20, 18, 18,
+	9, 18, 9, 13, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 18, 9, 7, 9,
+	7, 9, 9, 20, 18, 18, 9, 18, 18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 18, 9, 9,
+	18, 18, 9, 7, 9, 9, 20, 18, 18, 9, 18, 18, 9, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18,
+	9, 18, 6, 18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 7, 18, 9, 9, 9,
+	20, 18, 18, 9, 18, 9, 18, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9,
+	5, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 9, 18, 7, 18, 9, 9, 9, 20, 18, 18, 9, 18,
+	18, 9, 9, 18, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 6, 18, 18, 9, 9, 9, 9, 20, 18,
+	18, 9, 18, 9, 18, 6, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 9, 18, 18, 9, 7,
+	9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 9, 9,
+	18, 18, 9, 5, 9, 20, 18, 18, 9, 18, 9, 18, 9, 18, 9, 9, 18, 9, 20, 18, 9, 13, 18, 18,
+	18, 18, 18, 9, 9, 9, 17, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 18, 9, 9, 17, 9, 9,
+	20, 18, 18, 6, 18, 18, 18, 18, 9, 9, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9,
+	9, 18, 9, 17, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 18, 18, 9, 9, 17, 9, 9, 20, 18, 9,
+	13, 18, 18, 18, 9, 18, 9, 18, 9, 17, 9, 9, 20, 18, 18, 18, 18, 18, 18, 9, 9, 9, 9, 7,
+	9, 5, 9, 20, 18, 18, 18, 18, 18, 9, 18, 9, 9, 9, 7, 9, 5, 9, 20, 18, 9, 13, 18, 18,
+	18, 9, 18, 18, 9, 7, 9, 17, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 9, 9, 19, 9, 9,
+	20, 18, 18, 6, 18, 18, 9, 9, 18, 18, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 18,
+	9, 9, 19, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 18, 9, 5, 9, 17, 9, 9, 20, 18, 18,
+	6, 18, 9, 18, 18, 9, 7, 18, 9, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 18, 9, 7,
+	9, 17, 9, 9, 20, 18, 18, 18, 18, 18, 9, 9, 9, 7, 9, 18, 9, 9, 20, 18, 9, 13, 18, 18,
+	18, 9, 9, 18, 18, 9, 17, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 9, 18, 9, 19, 9, 9, 20,
+	18, 9, 13, 18, 18, 9, 18, 18, 18, 9, 9, 17, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 9,
+	18, 9, 17, 9, 9, 20, 18, 18, 6, 18, 9, 18, 9, 18, 18, 9, 7, 9, 9, 9, 20, 18, 9, 13,
+	18, 18, 9, 18, 18, 9, 9, 19, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 18, 18, 9, 17, 9,
+	9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 18, 9, 19, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 18,
+	18, 9, 9, 9, 17, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 18, 9, 18, 9, 9, 17, 9, 9, 20,
+	18, 9, 13, 18, 18, 18, 18, 18, 9, 9, 9, 7, 17, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9,
+	9, 19, 9, 7, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 9, 18, 18, 9, 9, 17, 9, 9, 20, 18,
+	9, 13, 18, 18, 18, 9, 18, 9, 19, 9, 7, 9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 5, 9,
+	7, 9, 7, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 19, 9, 7, 9, 7, 9, 9, 20, 18, 9,
+	18, 18, 18, 18, 18, 9, 7, 9, 7, 9, 7, 9, 9, 20, 18, 18, 6, 18, 18, 18, 9, 9, 9, 9,
+	9, 18, 9, 20, 18, 9, 13, 18, 18, 18, 9, 9, 18, 18, 9, 7, 17, 9, 9, 20, 18, 18, 6, 18,
+	18, 9, 18, 9, 9, 9, 9, 18, 9, 20, 18, 18, 18, 18, 9, 13, 18, 18, 9, 9, 9, 7, 9, 9,
+	17, 20, 18, 9, 13, 18, 18, 9, 18, 18, 9, 5, 19, 9, 7, 9, 9, 20, 18, 18, 18, 18, 18, 9,
+	13, 18, 9, 9, 9, 7, 9, 9, 17, 20, 18, 18, 18, 18, 18, 9, 9, 9, 7, 9, 9, 18, 9, 20,
+	18, 9, 13, 18, 18, 18, 9, 9, 18, 19, 9, 7, 9, 9, 20, 18, 18, 6, 18, 18, 9, 9, 18, 9,
+	9, 9, 18, 9, 20, 18, 9, 13, 18, 18, 9, 18, 6, 18, 18, 9, 9, 17, 9, 9, 20, 18, 9, 13,
+	18, 18, 9, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 18, 18, 9, 7,
+	17, 9, 9, 20, 18, 18, 6, 18, 9, 18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 9, 13, 18, 18, 9,
+	18, 9, 18, 19, 9, 7, 9, 9, 20, 18, 18, 6, 18, 9, 18, 9, 18, 9, 9, 9, 18, 9, 20, 18,
+	18, 18, 18, 18, 18, 9, 9, 9, 15, 9, 9, 19, 9, 20, 18, 18, 18, 18, 18, 9, 18, 9, 9, 15,
+	9, 9, 19, 9, 20, 18, 18, 9, 18, 6, 18, 18, 18, 9, 7, 9, 7, 9, 9, 9, 20, 18, 9, 13,
+	18, 18, 6, 18, 18, 9, 9, 9, 19, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 18, 18, 9, 7, 9,
+	9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 9, 18, 9, 9, 19, 9, 9, 20, 18, 18, 18, 9, 13, 18,
+	18, 18, 9, 9, 14, 9, 9, 19, 9, 20, 18, 18, 18, 9, 13, 18, 18, 9, 18, 9, 14, 9, 9, 19,
+	9, 20, 18, 18, 18, 9, 13, 18, 18, 18, 9, 14, 9, 9, 9, 19, 9, 20, 18, 18, 18, 9, 13, 18,
+	18, 9, 9, 9, 9, 19, 9, 20, 18, 9, 18, 18, 18, 9, 7, 18, 18, 9, 7, 9, 7, 9, 9, 20,
+	18, 18, 18, 9, 13, 18, 9, 18, 9, 9, 9, 19, 9, 20, 18, 18, 18, 18, 18, 18, 9, 9, 15, 9,
+	9, 9, 19, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 9, 7, 9, 19, 9, 9, 20, 18, 18, 18, 9,
+	18, 18, 18, 9, 7, 9, 15, 9, 9, 19, 9, 20, 18, 18, 18, 18, 9, 13, 18, 9, 9, 9, 9, 19,
+	9, 20, 18, 18, 18, 18, 9, 9, 9, 9, 18, 18, 9, 9, 20, 18, 18, 18, 18, 9, 9, 9, 9, 18,
+	9, 18, 9, 20, 18, 18, 9, 18, 9, 18, 7, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 18, 9, 9,
+	18, 18, 9, 7, 9, 18, 9, 9, 20, 18, 9, 13, 18, 18, 9, 9, 18, 18, 18, 9, 7, 17, 9, 9,
+	20, 18, 18, 18, 9, 9, 18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 18, 18, 9, 18, 9, 9, 9, 18,
+	18, 9, 9, 20, 18, 18, 18, 9, 18, 9, 9, 9, 18, 9, 18, 9, 20, 18, 9, 13, 18, 9, 18, 18,
+	18, 18, 9, 5, 9, 17, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 7, 18, 9, 9, 9, 9, 20,
+	18, 9, 13, 18, 9, 18, 18, 18, 18, 9, 7, 9, 17, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18,
+	9, 5, 9, 19, 9, 9, 20, 18, 18, 9, 18, 6, 18, 9, 18, 7, 18, 9, 9, 9, 9, 20, 18, 18,
+	9, 18, 18, 9, 7, 18, 9, 9, 18, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 6, 18, 18, 9, 5,
+	9, 17, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 9, 5, 19, 9, 7, 9, 9, 20, 18, 9, 13,
+	18, 9, 18, 18, 18, 18, 9, 7, 9, 6, 17, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 5, 9,
+	9, 9, 18, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 18, 18, 9, 7, 9, 9, 20, 18, 18, 9, 18,
+	18, 9, 7, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 5, 9, 15, 9, 9, 19,
+	9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 9, 7, 9, 19, 9, 9, 20, 18, 18, 9, 18, 18, 18, 18,
+	9, 7, 9, 15, 9, 9, 19, 9, 20, 18, 18, 9, 18, 18, 9, 13, 18, 9, 5, 9, 9, 19, 9, 20,
+	18, 18, 9, 18, 18, 9, 5, 9, 9, 18, 18, 9, 9, 20, 18, 18, 9, 18, 18, 9, 5, 9, 9, 18,
+	9, 18, 9, 20, 18, 18, 18, 9, 9, 9, 18, 18, 18, 9, 5, 9, 9, 20, 18, 9, 13, 18, 18, 9,
+	9, 18, 18, 9, 19, 9, 9, 20, 18, 18, 18, 9, 9, 9, 18, 18, 18, 9, 7, 9, 9, 20, 18, 18,
+	9, 18, 9, 18, 7, 18, 9, 9, 9, 18, 9, 20, 18, 18, 18, 9, 9, 18, 9, 9, 18, 18, 9, 9,
+	20, 18, 18, 18, 9, 9, 18, 9, 9, 18, 9, 18, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 18, 9,
+	9, 17, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 9, 18, 9, 17, 9, 9, 20, 18, 18, 9, 9,
+	18, 18, 18, 18, 9, 7, 9, 5, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 9, 9, 19, 9, 9,
+	20, 18, 9, 13, 18, 9, 18, 18, 9, 18, 18, 9, 17, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 9,
+	18, 9, 19, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 18, 9, 5, 9, 7, 9, 9, 20, 18, 9, 13,
+	18, 9, 18, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 18, 9, 7, 9, 7,
+	9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 9, 13, 18, 9, 18, 18,
+	9, 18, 19, 9, 7, 9, 9, 20, 18, 18, 9, 18, 6, 18, 9, 18, 9, 9, 9, 18, 9, 20, 18, 18,
+	9, 18, 9, 18, 6, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18, 9, 18, 9, 18, 18, 9, 7, 9, 18,
+	9, 9, 20, 18, 9, 13, 18, 9, 18, 9, 18, 18, 18, 9, 7, 17, 9, 9, 20, 18, 18, 9, 18, 9,
+	18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 18, 9, 18, 18, 9, 9, 9, 18, 18, 9, 9, 20, 18, 18,
+	9, 18, 18, 9, 9, 9, 18, 9, 18, 9, 20, 18, 18, 9, 18, 9, 9, 18, 18, 18, 9, 5, 9, 9,
+	20, 18, 9, 13, 18, 9, 18, 9, 18, 18, 9, 19, 9, 9, 20, 18, 18, 9, 18, 9, 9, 18, 18, 18,
+	9, 7, 9, 9, 20, 18, 18, 9, 18, 9, 9, 18, 18, 9, 5, 9, 18, 9, 20, 18, 18, 9, 18, 9,
+	18, 9, 9, 18, 18, 9, 9, 20, 18, 18, 9, 18, 9, 18, 9, 9, 18, 9, 18, 9, 20, 18, 9, 13,
+	18, 18, 18, 18, 18, 9, 9, 17, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 18, 9, 17, 9,
+	9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 7, 9, 5, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18,
+	18, 9, 9, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 18, 18, 9, 17, 9, 9, 9, 20, 18,
+	9, 13, 18, 18, 18, 9, 18, 9, 19, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 5, 9, 7,
+	9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 19, 9, 7, 9, 9, 9, 20, 18, 9, 18, 18, 18,
+	18, 18, 9, 7, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 9, 9, 19, 5, 9, 9,
+	20, 18, 9, 13, 18, 18, 18, 9, 18, 19, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 18,
+	9, 9, 19, 5, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 18, 9, 5, 17, 9, 9, 9, 20, 18,
+	9, 13, 18, 18, 9, 18, 18, 9, 5, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 18, 9,
+	7, 17, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 9, 5, 9, 18, 9, 9, 20, 18, 9, 13,
+	18, 18, 18, 9, 9, 18, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 9, 19, 9, 18, 9, 9,
+	20, 18, 9, 13, 18, 18, 9, 18, 18, 18, 9, 17, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18,
+	9, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 19, 9, 7, 9, 9, 9, 20, 18, 9, 13,
+	18, 18, 9, 18, 18, 9, 9, 19, 5, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 18, 19, 9, 9,
+	9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 19, 9, 18, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 18,
+	18, 9, 9, 17, 9, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 18, 9, 18, 9, 17, 9, 9, 9, 20,
+	18, 9, 18, 18, 6, 18, 18, 18, 9, 7, 9, 5, 9, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 18,
+	9, 9, 19, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 18, 18, 9, 5, 9, 9, 9, 20, 18, 9,
+	13, 18, 18, 6, 18, 9, 18, 9, 19, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 5, 9, 7,
+	9, 6, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 19, 9, 7, 9, 6, 9, 9, 20, 18, 9, 18,
+	18, 18, 18, 18, 9, 7, 9, 7, 9, 6, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 9, 9, 19,
+	7, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 18, 19, 9, 7, 9, 6, 9, 9, 20, 18, 9, 13, 18,
+	18, 18, 9, 18, 9, 9, 19, 7, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 6, 18, 18, 9, 5, 17,
+	9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 9, 7, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18,
+	9, 18, 18, 18, 9, 7, 9, 17, 7, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 9, 5, 9, 9,
+	18, 9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 18, 7, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18,
+	9, 9, 19, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 7, 18, 18, 9, 5, 9, 9, 9, 20, 18,
+	9, 13, 18, 18, 9, 18, 6, 18, 9, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 19, 9,
+	7, 9, 6, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 18, 9, 9, 19, 7, 9, 9, 20, 18, 9, 13,
+	18, 18, 9, 18, 9, 18, 6, 19, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 9, 19, 9, 9, 18,
+	9, 20, 18, 9, 18, 18, 6, 18, 18, 18, 9, 5, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 6,
+	18, 18, 9, 19, 9, 7, 9, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 18, 9, 7, 9, 7, 9, 9,
+	9, 20, 18, 9, 18, 18, 18, 18, 9, 5, 9, 7, 9, 18, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7,
+	18, 18, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 19, 9, 7, 9, 18, 9, 9, 20, 18,
+	9, 18, 9, 13, 18, 18, 18, 18, 9, 5, 9, 7, 17, 9, 9, 20, 18, 9, 13, 18, 18, 6, 18, 18,
+	9, 19, 9, 7, 9, 6, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 7, 9, 7, 17, 9,
+	9, 20, 18, 9, 18, 18, 18, 18, 9, 5, 9, 7, 9, 9, 18, 9, 20, 18, 9, 18, 18, 18, 9, 7,
+	18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 19, 9, 7, 9, 9, 18, 9, 20,
+	18, 18, 6, 18, 18, 18, 18, 9, 9, 15, 9, 9, 9, 19, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7,
+	9, 7, 9, 18, 9, 9, 20, 18, 9, 18, 18, 18, 9, 13, 18, 18, 9, 7, 9, 7, 9, 17, 9, 20,
+	18, 9, 18, 18, 18, 18, 9, 7, 9, 7, 9, 9, 18, 9, 20, 18, 18, 6, 18, 18, 9, 9, 9, 9,
+	18, 18, 9, 9, 20, 18, 18, 6, 18, 18, 9, 9, 9, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18, 9,
+	18, 7, 18, 18, 9, 7, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 19, 9, 7, 9, 18, 9, 9,
+	20, 18, 9, 18, 18, 9, 18, 7, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18,
+	19, 9, 7, 9, 9, 18, 9, 20, 18, 18, 6, 18, 9, 18, 9, 9, 9, 18, 18, 9, 9, 20, 18, 18,
+	6, 18, 9, 18, 9, 9, 9, 18, 9, 18, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 18, 9, 5, 17,
+	9, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 9, 5, 19, 9, 9, 9, 20, 18, 9, 13, 18, 9,
+	18, 18, 18, 18, 9, 7, 17, 9, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 7, 9, 9, 18, 9,
+	9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 18, 18, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9,
+	18, 9, 18, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 6, 18, 18, 9, 5, 17, 9, 9, 9, 20, 18,
+	9, 13, 18, 9, 18, 18, 18, 9, 7, 19, 9, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 18, 18, 9,
+	7, 9, 17, 7, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 9, 7, 9, 9, 9, 18, 9, 20, 18, 9,
+	13, 18, 9, 18, 18, 9, 18, 7, 19, 9, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 18, 9, 9,
+	18, 9, 20, 18, 18, 9, 18, 18, 18, 18, 9, 9, 15, 7, 9, 9, 19, 9, 20, 18, 18, 9, 18, 9,
+	13, 18, 18, 9, 7, 9, 19, 9, 9, 20, 18, 18, 9, 18, 6, 18, 18, 18, 9, 7, 9, 15, 9, 9,
+	19, 9, 20, 18, 18, 9, 18, 18, 9, 13, 18, 9, 7, 9, 9, 19, 9, 20, 18, 18, 9, 18, 18, 9,
+	7, 9, 9, 18, 18, 9, 9, 20, 18, 18, 9, 18, 18, 9, 7, 9, 9, 18, 9, 18, 9, 20, 18, 18,
+	18, 9, 9, 9, 18, 18, 18, 9, 9, 9, 20, 18, 18, 18, 9, 9, 9, 18, 18, 9, 18, 9, 9, 20,
+	18, 18, 18, 9, 9, 9, 18, 9, 18, 18, 9, 5, 9, 20, 18, 18, 18, 9, 9, 9, 18, 18, 9, 9,
+	18, 9, 20, 18, 18, 18, 9, 9, 9, 18, 9, 18, 18, 9, 9, 20, 18, 18, 18, 9, 9, 9, 18, 9,
+	18, 9, 18, 9, 20, 18, 18, 9, 9, 18, 18, 18, 18, 9, 5, 9, 9, 9, 20, 18, 9, 13, 18, 9,
+	18, 18, 18, 9, 19, 9, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 18, 9, 7, 9, 9, 9, 20, 18,
+	18, 9, 9, 18, 18, 18, 9, 5, 9, 18, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 9, 18, 19, 9,
+	9, 9, 20, 18, 9, 13, 18, 9, 18, 18, 9, 19, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18, 7,
+	18, 18, 9, 5, 9, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 9, 7, 18, 9, 9, 9, 20, 18, 18,
+	9, 9, 18, 18, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 9, 5, 9, 9,
+	18, 9, 20, 18, 18, 9, 9, 18, 18, 9, 18, 7, 18, 9, 9, 9, 20, 18, 9, 13, 18, 9, 18, 18,
+	9, 19, 9, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 7, 18, 18, 9, 7, 9, 9, 9, 20, 18, 18,
+	9, 9, 18, 18, 18, 9, 7, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18, 7, 18, 18, 9, 7, 9,
+	6, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 18, 9, 9, 18, 18,
+	9, 5, 9, 18, 18, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9, 5, 9, 18, 9, 18, 9, 20, 18, 18,
+	9, 18, 9, 9, 18, 18, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 9, 18, 18, 9, 18, 9, 9, 20,
+	18, 18, 9, 9, 18, 9, 18, 18, 7, 18, 9, 9, 9, 20, 18, 18, 9, 18, 9, 9, 18, 18, 9, 9,
+	18, 9, 20, 18, 18, 9, 18, 9, 9, 18, 9, 18, 18, 9, 9, 20, 18, 18, 9, 18, 9, 9, 18, 9,
+	18, 9, 18, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 5, 9, 9, 9, 9, 20, 18, 9, 13, 18, 18,
+	18, 18, 9, 19, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 7, 9, 9, 9, 9, 20, 18,
+	9, 18, 18, 18, 18, 9, 5, 9, 18, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 18, 19, 9, 9,
+	9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 19, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 18, 6, 18,
+	18, 9, 5, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 18, 9, 9, 9, 9, 20, 18, 9,
+	18, 18, 18, 18, 18, 9, 7, 9, 6, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 5, 9, 9, 18,
+	9, 9, 20, 18, 9, 18, 18, 18, 9, 18, 7, 18, 9, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9,
+	19, 9, 9, 18, 9, 9, 20, 18, 9, 18, 18, 18, 6, 18, 18, 9, 7, 9, 9, 9, 9, 20, 18, 9,
+	18, 18, 18, 18, 9, 7, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 13, 18, 18, 18, 9, 7, 17,
+	9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 7, 9, 9, 18, 9, 9, 20, 18, 9, 18, 18, 18, 9,
+	5, 9, 18, 18, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 5, 9, 18, 9, 18, 9, 9, 20, 18, 9,
+	13, 18, 18, 9, 18, 18, 19, 9, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 19, 9, 18, 9, 9,
+	9, 20, 18, 9, 18, 18, 9, 18, 18, 7, 18, 9, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 19,
+	9, 9, 18, 9, 9, 20, 18, 9, 13, 18, 18, 9, 19, 9, 18, 18, 9, 9, 9, 20, 18, 9, 13, 18,
+	18, 9, 19, 9, 18, 9, 18, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 18, 9, 5, 9, 9, 9, 9,
+	20, 18, 9, 13, 18, 18, 6, 18, 18, 9, 19, 9, 9, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 18,
+	9, 7, 9, 9, 9, 9, 20, 18, 9, 13, 18, 18, 18, 18, 9, 19, 9, 9, 7, 9, 9, 20, 18, 9,
+	18, 18, 18, 9, 7, 18, 18, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 18, 9, 18, 9, 9,
+	9, 20, 18, 9, 18, 18, 18, 6, 18, 18, 9, 5, 9, 9, 6, 9, 9, 20, 18, 9, 18, 18, 18, 18,
+	9, 7, 9, 18, 9, 7, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 13, 18, 9, 5, 9, 9, 9, 17,
+	20, 18, 9, 18, 18, 18, 18, 9, 5, 9, 9, 9, 18, 9, 20, 18, 9, 18, 18, 18, 9, 5, 9, 18,
+	18, 9, 7, 9, 9, 20, 18, 9, 13, 18, 18, 18, 9, 19, 9, 9, 9, 18, 9, 20, 18, 9, 18, 18,
+	18, 6, 18, 18, 9, 5, 9, 9, 7, 9, 9, 20, 18, 9, 18, 18, 9, 13, 18, 18, 9, 7, 19, 9,
+	9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 13, 18, 9, 7, 9, 9, 9, 17, 20, 18, 9, 18, 18, 18,
+	18, 9, 7, 9, 9, 9, 18, 9, 20, 18, 9, 13, 18, 18, 18, 9, 9, 19, 7, 18, 9, 9, 9, 20,
+	18, 9, 18, 18, 18, 9, 5, 9, 18, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 7, 18, 18, 9,
+	9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 7, 18, 9, 18, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9,
+	19, 9, 18, 18, 9, 7, 9, 9, 20, 18, 9, 13, 18, 18, 9, 18, 19, 9, 9, 9, 18, 9, 20, 18,
+	9, 13, 18, 18, 9, 18, 9, 19, 7, 18, 9, 9, 9, 20, 18, 9, 13, 18, 18, 9, 19, 9, 18, 9,
+	9, 18, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 5, 9, 17, 9, 9, 20, 18, 9, 18, 18,
+	6, 18, 18, 9, 7, 18, 9, 9, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 7, 9, 17,
+	9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 9, 5, 9, 19, 9, 9, 20, 18, 9, 18, 18, 6, 18,
+	9, 18, 7, 18, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 18, 9, 9, 18, 9, 9, 20, 18,
+	9, 18, 9, 13, 18, 18, 6, 18, 18, 9, 5, 9, 17, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18,
+	9, 5, 19, 9, 7, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 7, 9, 6, 17, 9, 9,
+	20, 18, 9, 18, 18, 6, 18, 18, 9, 5, 9, 9, 9, 18, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9,
+	18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 18, 9, 9, 9, 18, 9, 20, 18, 9, 18,
+	18, 18, 18, 18, 9, 5, 9, 15, 9, 9, 19, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 9, 7, 9,
+	19, 9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 7, 9, 15, 9, 9, 19, 9, 20, 18, 9, 18, 18,
+	18, 9, 13, 18, 9, 5, 9, 9, 19, 9, 20, 18, 9, 18, 18, 18, 9, 5, 9, 9, 18, 18, 9, 9,
+	20, 18, 9, 18, 18, 18, 9, 5, 9, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18, 9, 5, 9, 18, 18,
+	18, 9, 5, 9, 9, 20, 18, 9, 18, 18, 9, 18, 7, 18, 9, 9, 18, 9, 9, 20, 18, 9, 18, 18,
+	9, 5, 9, 18, 18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 18, 9, 18, 7, 18, 9, 9, 9, 18, 9,
+	20, 18, 9, 13, 18, 18, 9, 19, 9, 9, 18, 18, 9, 9, 20, 18, 9, 13, 18, 18, 9, 19, 9, 9,
+	18, 9, 18, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 5, 17, 9, 9, 9, 20, 18, 9, 18,
+	9, 13, 18, 18, 18, 9, 5, 19, 9, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 7, 17,
+	9, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 9, 7, 9, 9, 18, 9, 9, 20, 18, 9, 18, 18, 18,
+	9, 7, 9, 18, 18, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9, 18, 9, 18, 9, 9, 20, 18,
+	9, 18, 9, 13, 18, 18, 6, 18, 18, 9, 5, 17, 9, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18,
+	9, 7, 19, 9, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 18, 9, 7, 9, 17, 7, 9, 9, 20,
+	18, 9, 18, 18, 6, 18, 18, 9, 7, 9, 9, 9, 18, 9, 20, 18, 9, 18, 9, 13, 18, 18, 9, 18,
+	7, 19, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9, 18, 9, 9, 18, 9, 20, 18, 9, 18, 18,
+	18, 18, 18, 9, 9, 15, 7, 9, 9, 19, 9, 20, 18, 9, 18, 18, 9, 13, 18, 18, 9, 7, 9, 19,
+	9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 18, 9, 7, 9, 15, 9, 9, 19, 9, 20, 18, 9, 18, 18,
+	18, 9, 13, 18, 9, 7, 9, 9, 19, 9, 20, 18, 9, 18, 18, 18, 9, 7, 9, 9, 18, 18, 9, 9,
+	20, 18, 9, 18, 18, 18, 9, 7, 9, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18, 9, 5, 9, 18, 18,
+	18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 5, 9, 18, 18, 9, 18, 9, 9, 20, 18, 18, 18, 9, 9,
+	9, 18, 18, 7, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 5, 9, 18, 18, 9, 9, 18, 9, 20, 18,
+	9, 18, 18, 9, 5, 9, 18, 9, 18, 18, 9, 9, 20, 18, 9, 18, 18, 9, 5, 9, 18, 9, 18, 9,
+	18, 9, 20, 18, 18, 9, 9, 18, 18, 18, 18, 9, 9, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 9,
+	18, 9, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 7, 18, 9, 9, 9, 9, 20, 18, 18, 9, 9, 18,
+	18, 18, 9, 9, 18, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9, 18, 18, 9, 9, 9, 20, 18, 18, 9,
+	9, 18, 18, 9, 18, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18, 7, 18, 18, 9, 9, 9, 9, 20,
+	18, 9, 18, 9, 18, 18, 7, 18, 9, 18, 9, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9, 18, 18, 9,
+	7, 9, 9, 20, 18, 18, 9, 9, 18, 18, 18, 9, 9, 9, 18, 9, 20, 18, 18, 9, 9, 18, 18, 9,
+	9, 18, 18, 9, 5, 9, 20, 18, 18, 9, 9, 18, 18, 9, 18, 9, 9, 18, 9, 20, 18, 18, 9, 9,
+	18, 9, 18, 18, 18, 9, 5, 9, 9, 20, 18, 9, 18, 9, 18, 18, 7, 18, 9, 9, 18, 9, 9, 20,
+	18, 18, 9, 9, 18, 9, 18, 18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 9, 18, 18, 7, 18, 9, 9,
+	9, 18, 9, 20, 18, 18, 9, 9, 18, 18, 9, 9, 18, 18, 9, 9, 20, 18, 18, 9, 9, 18, 18, 9,
+	9, 18, 9, 18, 9, 20, 18, 18, 9, 9, 18, 9, 18, 18, 18, 9, 9, 9, 20, 18, 18, 9, 9, 18,
+	9, 18, 18, 9, 18, 9, 9, 20, 18, 18, 9, 9, 18, 9, 18, 9, 18, 18, 9, 5, 9, 20, 18, 18,
+	9, 9, 18, 9, 18, 18, 9, 9, 18, 9, 20, 18, 18, 9, 9, 18, 9, 18, 9, 18, 18, 9, 9, 20,
+	18, 18, 9, 9, 18, 9, 18, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 9, 9, 9,
+	9, 20, 18, 9, 18, 18, 18, 18, 9, 18, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 18, 18, 9,
+	5, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9,
+	18, 18, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 9, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18,
+	18, 6, 18, 18, 9, 9, 9, 9, 9, 20, 18, 9, 18, 18, 18, 6, 18, 9, 18, 9, 9, 9, 9, 20,
+	18, 9, 18, 18, 18, 9, 18, 18, 9, 7, 9, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 9, 9, 18,
+	9, 9, 20, 18, 9, 18, 18, 18, 9, 9, 18, 18, 9, 5, 9, 9, 20, 18, 9, 18, 18, 18, 9, 18,
+	9, 9, 18, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 18, 9, 5, 9, 9, 9, 20, 18, 9, 18, 18,
+	9, 13, 18, 18, 9, 19, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 18, 9, 7, 9, 9, 9, 20,
+	18, 9, 18, 18, 9, 18, 18, 9, 5, 9, 18, 9, 9, 20, 18, 9, 18, 18, 18, 9, 9, 18, 18, 9,
+	9, 9, 20, 18, 9, 18, 18, 18, 9, 9, 18, 9, 18, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 18,
+	9, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18,
+	9, 18, 18, 9, 5, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 9, 18, 9, 9, 20, 18, 9, 18,
+	18, 9, 18, 9, 18, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 9, 18, 9, 18, 9, 9, 20, 18,
+	9, 18, 18, 6, 18, 18, 18, 9, 9, 9, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 9, 18, 9, 9,
+	9, 9, 20, 18, 9, 18, 18, 18, 18, 18, 9, 9, 9, 7, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18,
+	9, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 6, 18, 9, 18, 18, 9, 9, 9, 9, 20, 18, 9, 18,
+	18, 6, 18, 9, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 18, 9, 5, 9, 7, 9,
+	9, 20, 18, 9, 18, 18, 9, 13, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18,
+	18, 9, 7, 9, 7, 9, 9, 20, 18, 9, 18, 18, 18, 18, 9, 9, 9, 9, 18, 9, 20, 18, 9, 18,
+	18, 18, 9, 9, 18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 18, 18, 9, 18, 9, 9, 9, 18, 9, 20,
+	18, 9, 18, 18, 9, 18, 6, 18, 18, 9, 5, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 7,
+	18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 9, 18, 18,
+	9, 18, 18, 9, 5, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 9, 18, 7, 18, 9, 9, 9, 20,
+	18, 9, 18, 18, 18, 9, 9, 18, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 6, 18, 18, 9, 9,
+	9, 9, 20, 18, 9, 18, 18, 9, 18, 6, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 18, 9,
+	18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 9, 9, 18, 9, 20, 18, 9, 18, 18,
+	9, 18, 9, 9, 18, 18, 9, 5, 9, 20, 18, 9, 18, 18, 9, 18, 9, 18, 9, 9, 18, 9, 20, 18,
+	9, 18, 9, 13, 18, 18, 18, 18, 9, 9, 17, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 9, 18,
+	9, 17, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 18, 9, 7, 9, 5, 9, 9, 20, 18, 9, 18, 9,
+	13, 18, 18, 18, 9, 9, 19, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 9, 18, 18, 9, 17, 9, 9,
+	20, 18, 9, 18, 9, 13, 18, 18, 9, 18, 9, 19, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 18, 9,
+	5, 9, 7, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 18, 9, 19, 9, 7, 9, 9, 20, 18, 9, 18,
+	9, 18, 18, 18, 18, 9, 7, 9, 7, 9, 9, 20, 18, 9, 18, 18, 6, 18, 18, 9, 9, 9, 9, 18,
+	9, 20, 18, 9, 18, 9, 13, 18, 18, 9, 18, 19, 9, 7, 9, 9, 20, 18, 9, 18, 18, 6, 18, 9,
+	18, 9, 9, 9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 6, 18, 18, 9, 7, 9, 9, 9, 20, 18, 9,
+	18, 18, 9, 18, 18, 9, 7, 9, 18, 9, 9, 20, 18, 9, 18, 9, 13, 18, 9, 18, 18, 18, 9, 7,
+	17, 9, 9, 20, 18, 9, 18, 18, 9, 18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 9, 18, 18, 18, 9,
+	9, 9, 18, 18, 9, 9, 20, 18, 9, 18, 18, 18, 9, 9, 9, 18, 9, 18, 9, 20, 18, 9, 18, 18,
+	9, 9, 18, 18, 18, 9, 5, 9, 9, 20, 18, 9, 18, 9, 13, 18, 9, 18, 18, 9, 19, 9, 9, 20,
+	18, 9, 18, 18, 9, 9, 18, 18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 18, 9, 9, 18, 18, 9, 5,
+	9, 18, 9, 20, 18, 9, 18, 18, 9, 18, 9, 9, 18, 18, 9, 9, 20, 18, 9, 18, 18, 9, 18, 9,
+	9, 18, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 18, 18, 9, 5, 9, 9, 9, 20, 18, 9, 18, 9,
+	13, 18, 18, 18, 9, 19, 9, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 18, 9, 7, 9, 9, 9, 20,
+	18, 9, 18, 9, 18, 18, 18, 9, 5, 9, 18, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 9, 18, 19,
+	9, 9, 9, 20, 18, 9, 18, 9, 13, 18, 18, 9, 19, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18,
+	6, 18, 18, 9, 5, 9, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 7, 18, 9, 9, 9, 20, 18,
+	9, 18, 9, 18, 18, 18, 18, 9, 7, 9, 6, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 5, 9,
+	9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 9, 18, 7, 18, 9, 9, 9, 20, 18, 9, 18, 9, 13, 18,
+	18, 9, 19, 9, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 6, 18, 18, 9, 7, 9, 9, 9, 20, 18,
+	9, 18, 9, 18, 18, 18, 9, 7, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 9, 13, 18, 18, 18, 9,
+	7, 17, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 7, 9, 9, 18, 9, 20, 18, 9, 18, 9, 18,
+	18, 9, 5, 9, 18, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18, 9, 5, 9, 18, 9, 18, 9, 20, 18,
+	9, 18, 18, 9, 9, 18, 18, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 9, 18, 18, 9, 18, 9, 9,
+	20, 18, 9, 18, 9, 18, 9, 18, 18, 7, 18, 9, 9, 9, 20, 18, 9, 18, 18, 9, 9, 18, 18, 9,
+	9, 18, 9, 20, 18, 9, 18, 18, 9, 9, 18, 9, 18, 18, 9, 9, 20, 18, 9, 18, 18, 9, 9, 18,
+	9, 18, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 18, 18, 9, 9, 9, 9, 20, 18, 9, 18, 9, 18,
+	18, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 9, 18, 18, 9, 18, 18, 9, 5, 9, 9, 20, 18, 9,
+	18, 9, 18, 18, 18, 9, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18, 9, 18, 18, 9, 9, 9, 20,
+	18, 9, 18, 9, 18, 18, 9, 18, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 18, 6, 18, 18, 9, 9,
+	9, 9, 20, 18, 9, 18, 9, 18, 18, 6, 18, 9, 18, 9, 9, 9, 20, 18, 9, 18, 9, 18, 18, 9,
+	18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 9, 18, 18, 18, 9, 9, 9, 18, 9, 20, 18, 9, 18, 9,
+	18, 18, 9, 9, 18, 18, 9, 5, 9, 20, 18, 9, 18, 9, 18, 18, 9, 18, 9, 9, 18, 9, 20, 18,
+	9, 18, 9, 18, 9, 18, 18, 18, 9, 5, 9, 9, 20, 18, 9, 18, 9, 18, 9, 13, 18, 18, 9, 19,
+	9, 9, 20, 18, 9, 18, 9, 18, 9, 18, 18, 18, 9, 7, 9, 9, 20, 18, 9, 18, 9, 18, 9, 18,
+	18, 9, 5, 9, 18, 9, 20, 18, 9, 18, 9, 18, 18, 9, 9, 18, 18, 9, 9, 20, 18, 9, 18, 9,
+	18, 18, 9, 9, 18, 9, 18, 9, 20, 18, 9, 18, 9, 18, 9, 18, 18, 18, 9, 9, 9, 20, 18, 9,
+	18, 9, 18, 9, 18, 18, 9, 18, 9, 9, 20, 18, 9, 18, 9, 18, 9, 18, 9, 18, 18, 9, 5, 9,
+	20, 18, 9, 18, 9, 18, 9, 18, 18, 9, 9, 18, 9, 20, 18, 9, 18, 9, 18, 9, 18, 9, 18, 18,
+	9, 9, 20, 18, 9, 18, 9, 18, 9, 18, 9, 18, 9, 18, 9, 20,
+};
+
+/** @brief Offset in @ref blk_sort_ops, by block size, location and rank */
+static const uint16_t blk_sort_index[7][4][720] = {
+	[2] = {
+		[BLK_A_TOP] = {
+			0, 1,
+		},
+		[BLK_A_BOT] = {
+			3, 7,
+		},
+		[BLK_B_TOP] = {
+			10, 14,
+		},
+		[BLK_B_BOT] = {
+			17, 22,
+		},
+	},
+	[3] = {
+		[BLK_A_TOP] = {
+			27, 28, 32, 34, 39, 44,
+		},
+		[BLK_A_BOT] = {
+			50, 57, 63, 70, 75, 80,
+		},
+		[BLK_B_TOP] = {
+			84, 91, 97, 103, 108, 113,
+		},
+		[BLK_B_BOT] = {
+			117, 124, 131, 139, 146, 153,
+		},
+	},
+	[4] = {
+		[BLK_A_TOP] = {
+			160, 161, 167, 171, 178, 185, 193, 195, 201, 206, 214, 221, 230, 235, 242, 248,
+			256, 264, 273, 281, 290, 298, 307, 316,
+		},
+		[BLK_A_BOT] = {
+			326, 336, 345, 355, 363, 371, 378, 388, 397, 407, 415, 424, 431, 441, 449, 459,
+			467, 474, 480, 488, 495, 503, 509, 515,
+		},
+		[BLK_B_TOP] = {
+			520, 529, 537, 546, 554, 562, 569, 577, 584, 593, 601, 608, 615, 624, 631, 639,
+			646, 652, 658, 666, 673, 680, 686, 692,
+		},
+		[BLK_B_BOT] = {
+			697, 706, 715, 725, 734, 743, 752, 762, 772, 782, 791, 801, 810, 820, 830, 840,
+			850, 859, 868, 877, 886, 896, 905, 914,
+		},
+	},
+	[5] = {
+		[BLK_A_TOP] = {
+			923, 924, 932, 938, 947, 956, 966, 970, 978, 985, 995, 1004, 1015, 1022, 1031, 1039,
+			1049, 1059, 1070, 1080, 1091, 1101, 1112, 1123, 1135, 1137, 1145, 1151, 1160, 1169, 1179, 1184,
+			1192, 1200, 1210, 1219, 1230, 1237, 1246, 1255, 1265, 1275, 1286, 1296, 1307, 1317, 1328, 1339,
+			1351, 1356, 1364, 1371, 1381, 1390, 1401, 1407, 1415, 1423, 1433, 1442, 1453, 1461, 1471, 1480,
+			1491, 1502, 1514, 1524, 1535, 1545, 1556, 1568, 1580, 1588, 1597, 1606, 1616, 1626, 1637, 1645,
+			1654, 1663, 1674, 1684, 1695, 1704, 1714, 1724, 1735, 1746, 1758, 1769, 1781, 1792, 1804, 1816,
+			1829, 1839, 1850, 1860, 1871, 1882, 1894, 1904, 1915, 1926, 1938, 1949, 1961, 1972, 1983, 1994,
+			2006, 2018, 2030, 2042, 2054, 2066, 2078, 2091,
+		},
+		[BLK_A_BOT] = {
+			2104, 2117, 2129, 2142, 2153, 2164, 2174, 2187, 2199, 2212, 2223, 2235, 2245, 2258, 2269, 2282,
+			2293, 2303, 2312, 2323, 2333, 2344, 2353, 2362, 2370, 2383, 2395, 2408, 2419, 2430, 2440, 2453,
+			2465, 2479, 2490, 2502, 2512, 2526, 2537, 2551, 2562, 2573, 2582, 2593, 2604, 2615, 2624, 2634,
+			2642, 2655, 2667, 2680, 2691, 2703, 2713, 2726, 2738, 2752, 2763, 2775, 2785, 2799, 2810, 2824,
+			2835, 2845, 2854, 2866, 2876, 2888, 2898, 2907, 2915, 2928, 2939, 2952, 2963, 2973, 2982, 2995,
+			3006, 3019, 3030, 3041, 3050, 3063, 3074, 3087, 3098, 3108, 3117, 3127, 3136, 3146, 3154, 3162,
+			3169, 3180, 3190, 3201, 3210, 3219, 3227, 3238, 3248, 3259, 3268, 3278, 3286, 3297, 3306, 3317,
+			3326, 3334, 3341, 3350, 3358, 3367, 3374, 3381,
+		},
+		[BLK_B_TOP] = {
+			3387, 3398, 3408, 3419, 3429, 3439, 3448, 3459, 3469, 3480, 3490, 3500, 3509, 3520, 3530, 3541,
+			3551, 3560, 3569, 3579, 3588, 3598, 3607, 3616, 3624, 3635, 3645, 3655, 3664, 3673, 3681, 3692,
+			3702, 3713, 3723, 3733, 3742, 3753, 3763, 3774, 3784, 3793, 3802, 3812, 3821, 3831, 3840, 3849,
+			3857, 3868, 3878, 3889, 3899, 3909, 3918, 3929, 3939, 3949, 3958, 3967, 3975, 3986, 3996, 4007,
+			4017, 4026, 4035, 4045, 4053, 4063, 4071, 4079, 4087, 4098, 4108, 4119, 4129, 4138, 4147, 4157,
+			4166, 4177, 4187, 4196, 4204, 4215, 4225, 4235, 4244, 4253, 4261, 4270, 4278, 4287, 4294, 4302,
+			4309, 4319, 4328, 4338, 4347, 4356, 4364, 4373, 4381, 4391, 4400, 4408, 4416, 4426, 4434, 4443,
+			4451, 4458, 4465, 4474, 4482, 4490, 4497, 4504,
+		},
+		[BLK_B_BOT] = {
+			4510, 4521, 4532, 4544, 4555, 4566, 4577, 4589, 4601, 4613, 4624, 4636, 4647, 4659, 4671, 4683,
+			4695, 4706, 4717, 4728, 4739, 4751, 4762, 4773, 4784, 4796, 4808, 4820, 4832, 4844, 4856, 4869,
+			4882, 4895, 4906, 4918, 4929, 4942, 4954, 4967, 4979, 4991, 5002, 5014, 5026, 5038, 5049, 5061,
+			5072, 5085, 5098, 5111, 5123, 5136, 5148, 5161, 5174, 5187, 5199, 5212, 5224, 5237, 5249, 5263,
+			5275, 5286, 5297, 5309, 5321, 5333, 5345, 5356, 5367, 5379, 5391, 5403, 5415, 5427, 5439, 5452,
+			5464, 5477, 5489, 5501, 5513, 5526, 5538, 5552, 5564, 5576, 5588, 5599, 5610, 5622, 5633, 5644,
+			5655, 5666, 5677, 5689, 5700, 5711, 5722, 5734, 5746, 5758, 5769, 5781, 5792, 5804, 5816, 5828,
+			5840, 5851, 5862, 5873, 5884, 5896, 5907, 5918,
+		},
+	},
+	[6] = {
+		[BLK_A_TOP] = {
+			5929, 5930, 5940, 5948, 5959, 5970, 5982, 5988, 5998, 6007, 6019, 6030, 6043, 6052, 6063, 6073,
+			6085, 6097, 6110, 6122, 6135, 6147, 6160, 6173, 6187, 6191, 6201, 6209, 6220, 6231, 6243, 6250,
+			6260, 6270, 6282, 6293, 6306, 6315, 6326, 6337, 6349, 6361, 6374, 6386, 6399, 6411, 6424, 6437,
+			6451, 6458, 6468, 6477, 6489, 6500, 6513, 6521, 6531, 6541, 6553, 6564, 6577, 6587, 6599, 6610,
+			6623, 6636, 6650, 6662, 6675, 6687, 6700, 6714, 6728, 6738, 6749, 6760, 6772, 6784, 6797, 6807,
+			6818, 6829, 6842, 6854, 6867, 6878, 6890, 6902, 6915, 6928, 6942, 6955, 6969, 6982, 6996, 7010,
+			7025, 7037, 7050, 7062, 7075, 7088, 7102, 7114, 7127, 7140, 7154, 7167, 7181, 7194, 7207, 7220,
+			7234, 7248, 7262, 7276, 7290, 7304, 7318, 7333, 7348, 7350, 7360, 7368, 7379, 7390, 7402, 7408,
+			7418, 7427, 7439, 7450, 7463, 7472, 7483, 7493, 7505, 7517, 7530, 7542, 7555, 7567, 7580, 7593,
+			7607, 7612, 7622, 7630, 7641, 7652, 7664, 7672, 7682, 7692, 7704, 7715, 7728, 7737, 7748, 7759,
+			7771, 7783, 7796, 7808, 7821, 7833, 7846, 7859, 7873, 7880, 7890, 7899, 7911, 7922, 7935, 7944,
+			7954, 7964, 7976, 7987, 8000, 8010, 8022, 8033, 8046, 8059, 8073, 8085, 8098, 8110, 8123, 8137,
+			8151, 8161, 8172, 8183, 8195, 8207, 8220, 8230, 8241, 8252, 8265, 8277, 8290, 8301, 8313, 8325,
+			8338, 8351, 8365, 8378, 8392, 8405, 8419, 8433, 8448, 8460, 8473, 8485, 8498, 8511, 8525, 8537,
+			8550, 8563, 8577, 8590, 8604, 8617, 8630, 8643, 8657, 8671, 8685, 8699, 8713, 8727, 8741, 8756,
+			8771, 8776, 8786, 8794, 8805, 8816, 8828, 8835, 8845, 8855, 8867, 8878, 8891, 8900, 8911, 8922,
+			8934, 8946, 8959, 8971, 8984, 8996, 9009, 9022, 9036, 9042, 9052, 9060, 9071, 9082, 9094, 9102,
+			9112, 9122, 9134, 9145, 9158, 9167, 9178, 9189, 9202, 9214, 9228, 9240, 9253, 9265, 9278, 9291,
+			9305, 9313, 9323, 9333, 9345, 9356, 9369, 9378, 9388, 9399, 9411, 9422, 9435, 9446, 9458, 9470,
+			9483, 9496, 9510, 9522, 9535, 9547, 9560, 9574, 9588, 9598, 9609, 9620, 9632, 9644, 9657, 9667,
+			9678, 9689, 9702, 9714, 9728, 9740, 9752, 9764, 9777, 9790, 9804, 9817, 9831, 9844, 9858, 9872,
+			9887, 9899, 9912, 9924, 9937, 9950, 9964, 9976, 9989, 10002, 10016, 10029, 10043, 10056, 10069, 10082,
+			10096, 10110, 10124, 10138, 10152, 10166, 10180, 10195, 10210, 10218, 10228, 10237, 10249, 10260, 10273, 10282,
+			10292, 10302, 10314, 10325, 10338, 10348, 10360, 10371, 10384, 10397, 10411, 10423, 10436, 10448, 10461, 10475,
+			10489, 10497, 10507, 10516, 10528, 10539, 10552, 10561, 10571, 10582, 10594, 10605, 10618, 10628, 10640, 10651,
+			10664, 10677, 10691, 10703, 10716, 10728, 10742, 10756, 10770, 10779, 10789, 10799, 10811, 10822, 10835, 10845,
+			10856, 10867, 10880, 10892, 10905, 10916, 10928, 10940, 10953, 10966, 10980, 10992, 11005, 11017, 11030, 11044,
+			11058, 11069, 11081, 11093, 11106, 11119, 11133, 11144, 11156, 11168, 11181, 11194, 11208, 11220, 11233, 11246,
+			11259, 11272, 11286, 11299, 11313, 11326, 11340, 11354, 11369, 11381, 11394, 11406, 11419, 11433, 11447, 11459,
+			11472, 11485, 11499, 11513, 11527, 11540, 11553, 11566, 11580, 11594, 11608, 11622, 11636, 11650, 11664, 11679,
+			11694, 11704, 11715, 11726, 11738, 11750, 11763, 11773, 11784, 11795, 11808, 11820, 11833, 11844, 11856, 11868,
+			11881, 11894, 11908, 11921, 11935, 11948, 11962, 11976, 11991, 12001, 12012, 12023, 12035, 12047, 12060, 12071,
+			12082, 12094, 12107, 12119, 12133, 12144, 12156, 12168, 12181, 12194, 12208, 12221, 12235, 12248, 12262, 12276,
+			12291, 12302, 12313, 12324, 12337, 12349, 12362, 12373, 12385, 12397, 12410, 12422, 12436, 12448, 12461, 12473,
+			12486, 12499, 12513, 12526, 12540, 12553, 12567, 12581, 12596, 12608, 12620, 12632, 12645, 12658, 12672, 12684,
+			12696, 12708, 12721, 12734, 12748, 12761, 12774, 12787, 12801, 12815, 12829, 12842, 12856, 12870, 12885, 12899,
+			12914, 12927, 12941, 12954, 12968, 12982, 12997, 13010, 13024, 13037, 13051, 13065, 13080, 13093, 13107, 13121,
+			13135, 13149, 13164, 13178, 13193, 13207, 13222, 13237, 13252, 13264, 13277, 13289, 13302, 13315, 13329, 13341,
+			13354, 13367, 13381, 13394, 13408, 13421, 13434, 13447, 13461, 13475, 13489, 13503, 13517, 13531, 13545, 13560,
+			13575, 13587, 13600, 13613, 13626, 13640, 13654, 13666, 13679, 13692, 13706, 13720, 13734, 13747, 13761, 13774,
+			13788, 13802, 13816, 13830, 13844, 13858, 13872, 13887, 13902, 13914, 13927, 13940, 13954, 13968, 13982, 13995,
+			14008, 14021, 14035, 14049, 14064, 14077, 14091, 14104, 14118, 14132, 14146, 14160, 14174, 14188, 14203, 14218,
+			14233, 14246, 14259, 14272, 14286, 14300, 14314, 14327, 14340, 14353, 14367, 14381, 14396, 14409, 14423, 14437,
+			14452, 14466, 14481, 14495, 14509, 14524, 14539, 14554, 14570, 14584, 14598, 14612, 14626, 14641, 14656, 14670,
+			14684, 14698, 14712, 14727, 14742, 14756, 14770, 14784, 14799, 14814, 14829, 14844, 14859, 14874, 14890, 14905,
+		},
+		[BLK_A_BOT] = {
+			14921, 14937, 14952, 14968, 14982, 14996, 15009, 15025, 15040, 15056, 15070, 15085, 15098, 15114, 15128, 15144,
+			15158, 15171, 15183, 15197, 15210, 15224, 15236, 15248, 15259, 15275, 15290, 15306, 15320, 15334, 15347, 15363,
+			15378, 15395, 15409, 15424, 15437, 15454, 15468, 15485, 15499, 15513, 15525, 15539, 15553, 15567, 15579, 15592,
+			15603, 15619, 15634, 15650, 15664, 15679, 15692, 15708, 15723, 15740, 15754, 15769, 15782, 15799, 15813, 15830,
+			15844, 15857, 15869, 15884, 15897, 15912, 15925, 15937, 15948, 15964, 15978, 15994, 16008, 16021, 16033, 16049,
+			16063, 16079, 16093, 16107, 16119, 16135, 16149, 16165, 16179, 16192, 16204, 16217, 16229, 16242, 16253, 16264,
+			16274, 16288, 16301, 16315, 16327, 16339, 16350, 16364, 16377, 16391, 16403, 16416, 16427, 16441, 16453, 16467,
+			16479, 16490, 16500, 16512, 16523, 16535, 16545, 16555, 16564, 16580, 16595, 16611, 16625, 16639, 16652, 16668,
+			16683, 16699, 16713, 16728, 16741, 16757, 16771, 16787, 16801, 16814, 16826, 16840, 16853, 16867, 16879, 16891,
+			16902, 16919, 16934, 16951, 16965, 16979, 16993, 17010, 17026, 17043, 17057, 17073, 17086, 17103, 17118, 17135,
+			17149, 17164, 17176, 17191, 17205, 17220, 17232, 17246, 17257, 17274, 17290, 17307, 17321, 17336, 17349, 17366,
+			17382, 17399, 17413, 17429, 17442, 17459, 17474, 17491, 17505, 17519, 17531, 17546, 17559, 17574, 17587, 17600,
+			17611, 17628, 17643, 17660, 17675, 17688, 17700, 17717, 17732, 17749, 17763, 17778, 17790, 17807, 17822, 17839,
+			17853, 17867, 17879, 17892, 17904, 17917, 17928, 17940, 17950, 17965, 17978, 17993, 18005, 18017, 18029, 18044,
+			18057, 18072, 18084, 18097, 18108, 18123, 18135, 18150, 18162, 18174, 18184, 18196, 18208, 18220, 18230, 18241,
+			18250, 18266, 18281, 18297, 18311, 18325, 18338, 18354, 18369, 18386, 18400, 18415, 18428, 18445, 18459, 18476,
+			18490, 18504, 18516, 18530, 18544, 18558, 18570, 18583, 18594, 18610, 18625, 18641, 18655, 18669, 18682, 18699,
+			18715, 18732, 18746, 18762, 18775, 18792, 18807, 18824, 18838, 18853, 18865, 18880, 18894, 18909, 18921, 18935,
+			18946, 18962, 18978, 18995, 19009, 19024, 19037, 19053, 19069, 19086, 19100, 19116, 19129, 19146, 19161, 19178,
+			19193, 19206, 19218, 19233, 19246, 19262, 19275, 19287, 19298, 19315, 19330, 19347, 19362, 19376, 19388, 19405,
+			19420, 19437, 19452, 19467, 19479, 19496, 19511, 19528, 19543, 19556, 19568, 19582, 19594, 19608, 19620, 19631,
+			19641, 19656, 19670, 19685, 19697, 19710, 19722, 19737, 19751, 19766, 19778, 19792, 19804, 19819, 19831, 19846,
+			19858, 19869, 19879, 19892, 19904, 19917, 19928, 19938, 19947, 19963, 19978, 19994, 20008, 20023, 20036, 20052,
+			20067, 20084, 20098, 20113, 20126, 20143, 20157, 20174, 20188, 20201, 20213, 20228, 20241, 20256, 20269, 20281,
+			20292, 20308, 20323, 20339, 20353, 20368, 20381, 20398, 20413, 20430, 20444, 20460, 20473, 20490, 20505, 20522,
+			20536, 20550, 20562, 20577, 20590, 20605, 20618, 20631, 20642, 20658, 20673, 20690, 20704, 20719, 20732, 20748,
+			20763, 20780, 20794, 20810, 20823, 20840, 20855, 20872, 20887, 20900, 20912, 20927, 20940, 20956, 20969, 20981,
+			20992, 21009, 21024, 21041, 21056, 21069, 21081, 21098, 21113, 21130, 21145, 21159, 21171, 21188, 21203, 21220,
+			21235, 21248, 21260, 21273, 21285, 21298, 21309, 21320, 21330, 21345, 21358, 21373, 21386, 21398, 21409, 21424,
+			21437, 21452, 21465, 21478, 21489, 21504, 21517, 21532, 21545, 21557, 21568, 21580, 21591, 21603, 21613, 21623,
+			21632, 21648, 21662, 21678, 21692, 21705, 21717, 21733, 21747, 21763, 21777, 21791, 21803, 21819, 21833, 21849,
+			21863, 21876, 21888, 21901, 21913, 21926, 21937, 21948, 21958, 21974, 21988, 22004, 22018, 22031, 22043, 22060,
+			22074, 22091, 22105, 22120, 22132, 22149, 22163, 22180, 22194, 22208, 22220, 22233, 22245, 22258, 22269, 22281,
+			22291, 22307, 22321, 22337, 22351, 22365, 22377, 22393, 22407, 22424, 22438, 22453, 22465, 22481, 22495, 22511,
+			22525, 22538, 22550, 22564, 22576, 22590, 22602, 22613, 22623, 22639, 22653, 22669, 22683, 22696, 22708, 22724,
+			22738, 22755, 22769, 22783, 22795, 22811, 22825, 22841, 22855, 22868, 22880, 22893, 22905, 22918, 22929, 22940,
+			22950, 22963, 22975, 22988, 22999, 23010, 23020, 23033, 23045, 23058, 23069, 23081, 23091, 23104, 23115, 23128,
+			23139, 23149, 23158, 23169, 23179, 23190, 23199, 23208, 23216, 23230, 23243, 23257, 23269, 23281, 23292, 23306,
+			23319, 23333, 23345, 23358, 23369, 23383, 23395, 23409, 23421, 23432, 23442, 23454, 23465, 23477, 23487, 23497,
+			23506, 23520, 23533, 23547, 23559, 23571, 23582, 23596, 23609, 23624, 23636, 23649, 23660, 23675, 23687, 23702,
+			23714, 23726, 23736, 23748, 23760, 23772, 23782, 23793, 23802, 23816, 23829, 23843, 23855, 23868, 23879, 23893,
+			23906, 23921, 23933, 23946, 23957, 23972, 23984, 23999, 24011, 24022, 24032, 24045, 24056, 24069, 24080, 24090,
+			24099, 24113, 24125, 24139, 24151, 24162, 24172, 24186, 24198, 24212, 24224, 24236, 24246, 24260, 24272, 24286,
+			24298, 24309, 24319, 24330, 24340, 24351, 24360, 24369, 24377, 24389, 24400, 24412, 24422, 24432, 24441, 24453,
+			24464, 24476, 24486, 24497, 24506, 24518, 24528, 24540, 24550, 24559, 24567, 24577, 24586, 24596, 24604, 24612,
+		},
+		[BLK_B_TOP] = {
+			24619, 24632, 24644, 24657, 24669, 24681, 24692, 24705, 24717, 24730, 24742, 24754, 24765, 24778, 24790, 24803,
+			24815, 24826, 24837, 24849, 24860, 24872, 24883, 24894, 24904, 24918, 24931, 24944, 24956, 24968, 24979, 24992,
+			25004, 25017, 25029, 25041, 25052, 25066, 25078, 25091, 25103, 25114, 25125, 25138, 25150, 25162, 25173, 25184,
+			25194, 25207, 25219, 25233, 25246, 25258, 25270, 25284, 25297, 25310, 25322, 25334, 25345, 25359, 25371, 25384,
+			25396, 25407, 25418, 25430, 25441, 25454, 25465, 25476, 25486, 25499, 25511, 25524, 25536, 25547, 25558, 25571,
+			25583, 25597, 25610, 25622, 25633, 25646, 25659, 25672, 25684, 25696, 25707, 25718, 25729, 25741, 25751, 25762,
+			25772, 25784, 25795, 25807, 25818, 25829, 25839, 25851, 25862, 25875, 25887, 25898, 25909, 25921, 25932, 25944,
+			25955, 25965, 25975, 25986, 25996, 26007, 26017, 26027, 26036, 26049, 26061, 26074, 26086, 26098, 26109, 26121,
+			26132, 26145, 26157, 26168, 26179, 26192, 26203, 26215, 26226, 26236, 26246, 26258, 26269, 26280, 26290, 26300,
+			26309, 26322, 26334, 26347, 26359, 26371, 26382, 26395, 26407, 26420, 26432, 26444, 26455, 26469, 26481, 26494,
+			26506, 26517, 26528, 26541, 26553, 26565, 26576, 26587, 26597, 26610, 26622, 26635, 26647, 26659, 26670, 26683,
+			26695, 26708, 26720, 26732, 26743, 26757, 26769, 26782, 26794, 26805, 26816, 26828, 26839, 26851, 26862, 26873,
+			26883, 26897, 26909, 26922, 26934, 26945, 26956, 26969, 26981, 26994, 27006, 27017, 27028, 27041, 27053, 27066,
+			27078, 27090, 27101, 27112, 27123, 27134, 27144, 27155, 27165, 27178, 27190, 27202, 27213, 27224, 27234, 27246,
+			27257, 27269, 27280, 27291, 27301, 27313, 27324, 27336, 27347, 27357, 27367, 27378, 27388, 27399, 27409, 27419,
+			27428, 27441, 27453, 27466, 27478, 27490, 27501, 27514, 27526, 27540, 27553, 27565, 27577, 27590, 27602, 27615,
+			27627, 27638, 27649, 27661, 27672, 27684, 27695, 27706, 27716, 27729, 27741, 27754, 27766, 27778, 27789, 27801,
+			27812, 27825, 27837, 27848, 27859, 27872, 27883, 27895, 27906, 27916, 27926, 27938, 27949, 27960, 27970, 27980,
+			27989, 28002, 28014, 28027, 28039, 28051, 28063, 28076, 28088, 28101, 28113, 28125, 28136, 28149, 28161, 28174,
+			28186, 28197, 28208, 28221, 28232, 28244, 28255, 28265, 28275, 28288, 28300, 28314, 28327, 28339, 28351, 28364,
+			28376, 28389, 28401, 28412, 28423, 28436, 28448, 28461, 28473, 28484, 28495, 28507, 28518, 28529, 28539, 28550,
+			28560, 28572, 28584, 28597, 28609, 28621, 28631, 28643, 28655, 28667, 28678, 28689, 28699, 28711, 28722, 28734,
+			28745, 28755, 28765, 28777, 28787, 28798, 28808, 28818, 28827, 28840, 28852, 28866, 28879, 28891, 28903, 28916,
+			28928, 28941, 28953, 28965, 28976, 28990, 29002, 29015, 29027, 29038, 29049, 29061, 29072, 29084, 29095, 29106,
+			29116, 29128, 29139, 29152, 29164, 29175, 29186, 29199, 29211, 29224, 29236, 29248, 29259, 29273, 29285, 29298,
+			29310, 29321, 29332, 29344, 29355, 29367, 29378, 29389, 29399, 29412, 29424, 29437, 29449, 29461, 29473, 29485,
+			29496, 29509, 29521, 29532, 29543, 29556, 29567, 29579, 29590, 29600, 29610, 29622, 29633, 29645, 29655, 29665,
+			29674, 29687, 29700, 29713, 29725, 29737, 29749, 29762, 29774, 29787, 29799, 29810, 29821, 29835, 29847, 29860,
+			29872, 29883, 29894, 29906, 29917, 29929, 29939, 29950, 29960, 29972, 29983, 29995, 30006, 30017, 30027, 30038,
+			30049, 30061, 30072, 30083, 30092, 30104, 30115, 30126, 30137, 30147, 30156, 30167, 30177, 30188, 30197, 30207,
+			30216, 30229, 30241, 30254, 30266, 30277, 30288, 30301, 30313, 30326, 30338, 30349, 30360, 30373, 30385, 30398,
+			30410, 30421, 30432, 30443, 30454, 30466, 30476, 30487, 30497, 30510, 30521, 30533, 30544, 30554, 30564, 30577,
+			30589, 30602, 30614, 30625, 30636, 30649, 30661, 30674, 30686, 30697, 30708, 30719, 30730, 30741, 30751, 30762,
+			30772, 30785, 30797, 30810, 30822, 30833, 30844, 30857, 30868, 30880, 30891, 30901, 30911, 30924, 30936, 30949,
+			30961, 30972, 30983, 30994, 31005, 31016, 31026, 31036, 31045, 31058, 31070, 31083, 31095, 31106, 31117, 31129,
+			31141, 31154, 31166, 31177, 31188, 31201, 31212, 31224, 31235, 31245, 31255, 31267, 31278, 31289, 31299, 31309,
+			31318, 31329, 31339, 31350, 31360, 31371, 31381, 31391, 31401, 31412, 31422, 31432, 31441, 31452, 31462, 31472,
+			31482, 31491, 31499, 31510, 31520, 31530, 31539, 31548, 31556, 31568, 31579, 31591, 31602, 31613, 31623, 31635,
+			31646, 31658, 31669, 31680, 31690, 31702, 31713, 31725, 31736, 31746, 31756, 31767, 31777, 31788, 31798, 31808,
+			31817, 31829, 31840, 31851, 31861, 31871, 31880, 31892, 31903, 31915, 31926, 31937, 31947, 31959, 31970, 31982,
+			31993, 32003, 32013, 32024, 32034, 32045, 32055, 32065, 32074, 32086, 32097, 32109, 32120, 32131, 32141, 32153,
+			32164, 32175, 32185, 32195, 32204, 32216, 32227, 32239, 32250, 32260, 32270, 32281, 32290, 32301, 32310, 32319,
+			32328, 32340, 32351, 32363, 32374, 32384, 32394, 32405, 32415, 32427, 32438, 32448, 32457, 32469, 32480, 32491,
+			32501, 32511, 32520, 32530, 32539, 32549, 32557, 32566, 32574, 32585, 32595, 32606, 32616, 32626, 32635, 32645,
+			32654, 32665, 32675, 32684, 32693, 32704, 32713, 32723, 32732, 32740, 32748, 32758, 32767, 32776, 32784, 32792,
+		},
+		[BLK_B_BOT] = {
+			32799, 32812, 32825, 32839, 32852, 32865, 32878, 32892, 32906, 32920, 32933, 32947, 32960, 32974, 32988, 33002,
+			33016, 33029, 33042, 33055, 33068, 33082, 33095, 33108, 33121, 33135, 33149, 33163, 33177, 33191, 33205, 33220,
+			33235, 33250, 33263, 33277, 33290, 33305, 33319, 33334, 33348, 33362, 33375, 33389, 33403, 33417, 33430, 33444,
+			33457, 33472, 33487, 33502, 33516, 33531, 33545, 33560, 33575, 33590, 33604, 33619, 33633, 33648, 33662, 33678,
+			33692, 33705, 33718, 33732, 33746, 33760, 33774, 33787, 33800, 33814, 33828, 33842, 33856, 33870, 33884, 33899,
+			33913, 33928, 33942, 33956, 33970, 33985, 33999, 34015, 34029, 34043, 34057, 34070, 34083, 34097, 34110, 34123,
+			34136, 34149, 34162, 34176, 34189, 34202, 34215, 34229, 34243, 34257, 34270, 34284, 34297, 34311, 34325, 34339,
+			34353, 34366, 34379, 34392, 34405, 34419, 34432, 34445, 34458, 34472, 34486, 34501, 34515, 34529, 34543, 34557,
+			34571, 34586, 34600, 34614, 34628, 34643, 34658, 34673, 34687, 34701, 34715, 34729, 34743, 34757, 34771, 34785,
+			34799, 34814, 34829, 34844, 34859, 34874, 34889, 34904, 34919, 34934, 34947, 34962, 34975, 34991, 35006, 35022,
+			35036, 35050, 35063, 35078, 35093, 35108, 35121, 35135, 35148, 35163, 35178, 35193, 35208, 35223, 35238, 35254,
+			35270, 35286, 35300, 35315, 35329, 35345, 35360, 35376, 35390, 35404, 35417, 35432, 35446, 35461, 35475, 35489,
+			35502, 35517, 35532, 35547, 35562, 35576, 35590, 35606, 35621, 35637, 35651, 35666, 35680, 35696, 35711, 35727,
+			35741, 35755, 35769, 35783, 35797, 35811, 35824, 35838, 35851, 35865, 35879, 35893, 35907, 35921, 35935, 35950,
+			35965, 35980, 35993, 36007, 36020, 36035, 36049, 36064, 36078, 36092, 36105, 36119, 36133, 36147, 36160, 36174,
+			36187, 36202, 36217, 36232, 36247, 36262, 36277, 36292, 36307, 36323, 36337, 36352, 36366, 36382, 36397, 36413,
+			36427, 36442, 36456, 36471, 36486, 36501, 36515, 36530, 36544, 36560, 36576, 36592, 36607, 36623, 36638, 36654,
+			36670, 36686, 36700, 36716, 36730, 36746, 36762, 36778, 36792, 36807, 36821, 36837, 36852, 36868, 36882, 36897,
+			36911, 36926, 36941, 36957, 36972, 36987, 37002, 37018, 37034, 37050, 37064, 37080, 37094, 37109, 37124, 37140,
+			37154, 37167, 37180, 37195, 37209, 37225, 37239, 37252, 37265, 37281, 37296, 37312, 37327, 37342, 37356, 37373,
+			37389, 37406, 37421, 37436, 37450, 37466, 37481, 37497, 37512, 37526, 37540, 37554, 37568, 37582, 37596, 37609,
+			37622, 37637, 37652, 37667, 37681, 37696, 37710, 37725, 37740, 37755, 37769, 37784, 37798, 37813, 37827, 37843,
+			37857, 37870, 37883, 37897, 37911, 37925, 37939, 37952, 37965, 37980, 37995, 38010, 38024, 38039, 38053, 38068,
+			38083, 38098, 38113, 38128, 38143, 38159, 38174, 38190, 38205, 38219, 38233, 38248, 38262, 38277, 38292, 38306,
+			38320, 38336, 38352, 38368, 38383, 38398, 38413, 38429, 38445, 38461, 38476, 38492, 38507, 38524, 38539, 38556,
+			38571, 38586, 38600, 38615, 38630, 38646, 38661, 38676, 38690, 38706, 38722, 38738, 38753, 38768, 38783, 38800,
+			38817, 38834, 38849, 38865, 38880, 38896, 38911, 38928, 38943, 38957, 38971, 38986, 39001, 39017, 39032, 39046,
+			39060, 39076, 39091, 39107, 39122, 39136, 39150, 39167, 39182, 39199, 39214, 39229, 39243, 39259, 39274, 39291,
+			39306, 39320, 39334, 39347, 39360, 39374, 39387, 39400, 39413, 39427, 39441, 39455, 39469, 39483, 39497, 39512,
+			39526, 39541, 39555, 39569, 39583, 39598, 39612, 39628, 39642, 39656, 39670, 39683, 39696, 39710, 39723, 39736,
+			39749, 39763, 39777, 39791, 39805, 39819, 39833, 39848, 39862, 39877, 39891, 39905, 39919, 39934, 39948, 39964,
+			39978, 39992, 40006, 40020, 40034, 40048, 40062, 40076, 40090, 40105, 40120, 40135, 40150, 40164, 40178, 40194,
+			40209, 40225, 40239, 40254, 40268, 40284, 40299, 40315, 40329, 40344, 40358, 40372, 40386, 40401, 40415, 40430,
+			40444, 40460, 40475, 40491, 40506, 40521, 40535, 40552, 40568, 40585, 40600, 40615, 40629, 40645, 40660, 40676,
+			40691, 40705, 40719, 40734, 40748, 40763, 40777, 40791, 40805, 40821, 40836, 40852, 40867, 40881, 40895, 40912,
+			40927, 40944, 40959, 40974, 40988, 41004, 41019, 41036, 41051, 41065, 41079, 41093, 41107, 41121, 41135, 41149,
+			41163, 41176, 41189, 41203, 41216, 41229, 41242, 41256, 41270, 41284, 41297, 41311, 41324, 41338, 41352, 41366,
+			41380, 41393, 41406, 41419, 41432, 41446, 41459, 41472, 41485, 41498, 41511, 41525, 41538, 41551, 41564, 41578,
+			41592, 41606, 41619, 41633, 41646, 41660, 41674, 41688, 41702, 41715, 41728, 41741, 41754, 41768, 41781, 41794,
+			41807, 41821, 41835, 41849, 41863, 41877, 41891, 41906, 41921, 41936, 41949, 41963, 41976, 41991, 42005, 42020,
+			42034, 42048, 42061, 42075, 42089, 42103, 42116, 42130, 42143, 42158, 42173, 42188, 42202, 42217, 42231, 42246,
+			42261, 42276, 42290, 42305, 42319, 42334, 42348, 42364, 42378, 42391, 42404, 42418, 42432, 42446, 42460, 42473,
+			42486, 42500, 42514, 42528, 42542, 42556, 42570, 42585, 42599, 42614, 42628, 42642, 42656, 42671, 42685, 42701,
+			42715, 42729, 42743, 42756, 42769, 42783, 42796, 42809, 42822, 42835, 42848, 42862, 42875, 42888, 42901, 42915,
+			42929, 42943, 42956, 42970, 42983, 42997, 43011, 43025, 43039, 43052, 43065, 43078, 43091, 43105, 43118, 43131,
+		},
+	},
+};
+
+#endif // SORT_TABLES_H
@@ -5,37 +5,82 @@
 
 /* --- Stack --- */
 
+/** @brief Value contribution to the rolling stack hash */
+static inline uint64_t
+hash_value(value_t value)
+{
+	uint64_t x = (uint64_t)value + 0x9E3779B97F4A7C15ull;
+	x ^= x >> 31;
+	x *= 0xBF58476D1CE4E5B9ull;
+	return x ^ (x >> 29);
+}
+
 stack_t
-stack_new(size_t capacity)
+stack_new(value_t* data, size_t capacity)
 {
 	assert(capacity);
-	int* const buf = xmalloc(3 * capacity * sizeof(int));
 	return (stack_t){
-		.start = buf,
-		.data = buf + capacity,
+		.data = data,
+		.head = 0,
 		.size = 0,
 		.capacity = capacity,
+		.hash = 0,
+		.weight = 1,
 	};
 }
 
 void
-stack_destroy(stack_t* stack)
+stack_append(stack_t* stack, value_t value)
+{
+	assert(stack->size < stack->capacity);
+	stack->data[stack_index(stack, stack->size++)] = value;
+	stack->hash += hash_value(value) * stack->weight;
+	stack->weight *= STACK_HASH_BASE;
+}
+
+void
+stack_copy(const stack_t* stack, value_t* out)
+{
+	const size_t first = stack->capacity - stack->head;
+	if (stack->size <= first)
+		memcpy(out, stack->data + stack->head, stack->size * sizeof(value_t));
+	else {
+		memcpy(out, stack->data + stack->head, first * sizeof(value_t));
+		memcpy(out + first, stack->data, (stack->size - first) * sizeof(value_t));
+	}
+}
+
+int
+stack_equal(const stack_t* stack, const value_t* values)
 {
-	assert(stack->data);
-	assert(stack->start);
-	free(stack->start);
+	const size_t first = stack->capacity - stack->head;
+	if (stack->size <= first)
+		return !memcmp(values, stack->data + stack->head, stack->size * sizeof(value_t));
+	return !memcmp(values, stack->data + stack->head, first * sizeof(value_t)) &&
+	       !memcmp(values + first, stack->data, (stack->size - first) * sizeof(value_t));
 }
 
 int
 stack_is_sorted(const stack_t* stack)
 {
 	for (size_t i = 1; i < stack->size; ++i) {
-		if (stack->data[i - 1] > stack->data[i])
+		if (stack_get(stack, i - 1) > stack_get(stack, i))
 			return (0);
 	}
 	return (1);
 }
 
+/** @brief Copy @p src into @p dst, storing values from the start of @p dst's ring */
+static inline void
+stack_clone_into(stack_t* dst, const stack_t* src)
+{
+	stack_copy(src, dst->data);
+	dst->head = 0;
+	dst->size = src->size;
+	dst->hash = src->hash;
+	dst->weight = src->weight;
+}
+
 /* --- Save --- */
 
 save_t
@@ -44,13 +89,15 @@ save_new(const struct state_t* state)
 	assert(state->sa.capacity == state->sb.capacity);
 	assert(state->sa.size + state->sb.size == state->sa.capacity);
 	save_t save = {
-		.data = xmalloc(state->sa.capacity * sizeof(int)),
+		.data = xmalloc(state->sa.capacity * sizeof(value_t)),
 		.sz_a = state->sa.size,
 		.sz_b = state->sb.size,
 		.op = STACK_OP_NOP,
+		.hash = state_hash(state),
+		.run = 0,
 	};
-	memcpy(save.data, state->sa.data, state->sa.size * sizeof(int));
-	memcpy(save.data + state->sa.size, state->sb.data, state->sb.size * sizeof(int));
+	stack_copy(&state->sa, save.data);
+	stack_copy(&state->sb, save.data + state->sa.size);
 	return save;
 }
 
@@ -62,19 +109,129 @@ save_destroy(save_t* save)
 }
 
 /* --- State --- */
+
+/** @brief Number of checkpoints recorded for @p saves saves */
+static inline size_t
+checkpoints_count(size_t saves)
+{
+	return (saves + STATE_CHECKPOINT_INTERVAL - 1) / STATE_CHECKPOINT_INTERVAL;
+}
+
+static inline void
+state_op_raw(state_t* state, enum stack_op op);
+static inline void
+state_op_n_raw(state_t* state, enum stack_op op, size_t count);
+
+/** @brief Find save @p history in the op log, as a run index and an offset in the run */
+static void
+oplog_seek(const state_t* state, size_t history, size_t* run, size_t* offset)
+{
+	assert(history < state->saves_size);
+
+	// Save 0 is alone in the first run, other runs start after a checkpoint
+	size_t save = 0;
+	size_t r = 0;
+	if (history != 0) {
+		const size_t checkpoint = (history - 1) / STATE_CHECKPOINT_INTERVAL;
+		save = checkpoint * STATE_CHECKPOINT_INTERVAL + 1;
+		r = state->checkpoints[checkpoint].run;
+	}
+	while (save + state->oplog[r].count <= history)
+		save += state->oplog[r++].count;
+	*run = r;
+	*offset = history - save;
+}
+
+/** @brief Restore @p new's stacks to save @p history of @p state */
+static void
+state_restore(state_t* new, const state_t* state, size_t history)
+{
+	assert(history < state->saves_size);
+
+	const size_t checkpoint = history / STATE_CHECKPOINT_INTERVAL;
+	const save_t* save = &state->checkpoints[checkpoint];
+	new->sa.head = 0;
+	new->sa.size = 0;
+	new->sa.hash = 0;
+	new->sa.weight = 1;
+	new->sb.head = 0;
+	new->sb.size = 0;
+	new->sb.hash = 0;
+	new->sb.weight = 1;
+	for (size_t i = 0; i < save->sz_a; ++i)
+		stack_append(&new->sa, save->data[i]);
+	for (size_t i = 0; i < save->sz_b; ++i)
+		stack_append(&new->sb, save->data[save->sz_a + i]);
+
+	const size_t op_count = new->op_count;
+	size_t run = save->run;
+	for (size_t i = checkpoint * STATE_CHECKPOINT_INTERVAL; i < history; ++run) {
+		const size_t count = state->oplog[run].count < history - i ? state->oplog[run].count
+		                                                          : history - i;
+		state_op_n_raw(new, state->oplog[run].op, count);
+		i += count;
+	}
+	new->op_count = op_count;
+}
+
+/** @brief Allocate both stacks of @p state in a single buffer, owned by `sa` */
+static inline void
+state_new_stacks(state_t* state, size_t capacity)
+{
+	value_t* const buf = xmalloc(2 * capacity * sizeof(value_t));
+	state->sa = stack_new(buf, capacity);
+	state->sb = stack_new(buf + capacity, capacity);
+}
+
+/** @brief Store the current stacks of @p state into @p save */
+static inline void
+save_store(const state_t* state, save_t* save)
+{
+	save->sz_a = state->sa.size;
+	save->sz_b = state->sb.size;
+	save->hash = state_hash(state);
+	stack_copy(&state->sa, save->data);
+	stack_copy(&state->sb, save->data + state->sa.size);
+}
+
 state_t
 state_new(size_t capacity)
 {
-	return (state_t){
-		.sa = stack_new(capacity),
-		.sb = stack_new(capacity),
+	state_t new = {
 		.bifurcate_point = 0,
-		.saves = xmalloc(sizeof(save_t) * 16),
-		.saves_capacity = 16,
+		.oplog = xmalloc(sizeof(op_run_t) * 16),
+		.oplog_size = 0,
+		.oplog_capacity = 16,
 		.saves_size = 0,
+		.checkpoints = NULL,
+		.checkpoints_capacity = 0,
 		.op_count = 0,
 		.search_depth = 0,
+		.undo_marks = 0,
 	};
+	state_new_stacks(&new, capacity);
+	return new;
+}
+
+state_t
+state_scratch(size_t capacity)
+{
+	state_t new = {
+		.bifurcate_point = SIZE_MAX,
+		.oplog = NULL,
+		.oplog_size = 0,
+		.oplog_capacity = 0,
+		.saves_size = 0,
+		.checkpoints = NULL,
+		.checkpoints_capacity = 0,
+		.op_count = 0,
+		.search_depth = 0,
+		.undo_marks = 0,
+	};
+	value_t* const buf = arena_alloc(2 * capacity * sizeof(value_t));
+	new.sa = stack_new(buf, capacity);
+	new.sb = stack_new(buf + capacity, capacity);
+	return new;
 }
 
 void
@@ -83,11 +240,13 @@ state_destroy(state_t* state)
 	assert(state->sa.capacity == state->sb.capacity);
 	assert(state->sa.size + state->sb.size == state->sa.capacity);
 
-	for (size_t i = state->bifurcate_point; i < state->saves_size; ++i)
-		save_destroy(&state->saves[i]);
-	stack_destroy(&state->sa);
-	stack_destroy(&state->sb);
-	free(state->saves);
+	if (state->bifurcate_point == 0) {
+		for (size_t i = 0; i < checkpoints_count(state->saves_size); ++i)
+			save_destroy(&state->checkpoints[i]);
+	}
+	free(state->sa.data);
+	free(state->oplog);
+	free(state->checkpoints);
 }
 
 state_t
@@ -97,54 +256,75 @@ state_clone(const state_t* state)
 	assert(state->sa.size + state->sb.size == state->sa.capacity);
 
 	state_t new = {
-		.sa = stack_new(state->sa.capacity),
-		.sb = stack_new(state->sb.capacity),
 		.bifurcate_point = SIZE_MAX,
-		.saves = NULL,
-		.saves_capacity = 0,
+		.oplog = NULL,
+		.oplog_size = 0,
+		.oplog_capacity = 0,
 		.saves_size = 0,
+		.checkpoints = NULL,
+		.checkpoints_capacity = 0,
 		.op_count = state->op_count,
 		.search_depth = state->search_depth,
+		.undo_marks = 0,
 	};
-	memcpy(new.sa.data, state->sa.data, sizeof(int) * state->sa.size);
-	new.sa.size = state->sa.size;
-	memcpy(new.sb.data, state->sb.data, sizeof(int) * state->sb.size);
-	new.sb.size = state->sb.size;
+	state_new_stacks(&new, state->sa.capacity);
+	stack_clone_into(&new.sa, &state->sa);
+	stack_clone_into(&new.sb, &state->sb);
 
 	return new;
 }
 
+/** @brief Deep copy the first @p history saves of @p state into @p new */
+static void
+state_copy_history(state_t* new, const state_t* state, size_t history)
+{
+	const size_t checkpoints = checkpoints_count(history);
+
+	// Copy the runs holding the first `history` saves, truncating the last one
+	size_t runs = 0;
+	size_t saves = 0;
+	while (saves < history)
+		saves += state->oplog[runs++].count;
+	new->oplog = xmalloc(sizeof(op_run_t) * runs);
+	new->oplog_size = runs;
+	new->oplog_capacity = runs;
+	new->saves_size = history;
+	memcpy(new->oplog, state->oplog, sizeof(op_run_t) * runs);
+	if (runs)
+		new->oplog[runs - 1].count -= (uint32_t)(saves - history) & ((1u << 27) - 1);
+
+	new->checkpoints = xmalloc(sizeof(save_t) * checkpoints);
+	new->checkpoints_capacity = checkpoints;
+	for (size_t i = 0; i < checkpoints; ++i) {
+		value_t* data = xmalloc(new->sa.capacity * sizeof(value_t));
+		memcpy(data, state->checkpoints[i].data, sizeof(value_t) * new->sa.capacity);
+		new->checkpoints[i] = (save_t){
+			.data = data,
+			.sz_a = state->checkpoints[i].sz_a,
+			.sz_b = state->checkpoints[i].sz_b,
+			.op = state->checkpoints[i].op,
+			.hash = state->checkpoints[i].hash,
+			.run = state->checkpoints[i].run,
+		};
+	}
+}
+
 state_t
 state_deep_clone(const state_t* state)
 {
 	assert(state->sa.capacity == state->sb.capacity);
 	assert(state->sa.size + state->sb.size == state->sa.capacity);
 	state_t new = {
-		.sa = stack_new(state->sa.capacity),
-		.sb = stack_new(state->sb.capacity),
 		.bifurcate_point = 0,
-		.saves = xmalloc(sizeof(save_t) * state->saves_size),
-		.saves_capacity = state->saves_size,
-		.saves_size = state->saves_size,
 		.op_count = state->op_count,
 		.search_depth = state->search_depth,
 	};
 
-	memcpy(new.sa.data, state->sa.data, sizeof(int) * state->sa.size);
-	new.sa.size = state->sa.size;
-	memcpy(new.sb.data, state->sb.data, sizeof(int) * state->sb.size);
-	new.sb.size = state->sb.size;
+	state_new_stacks(&new, state->sa.capacity);
+	stack_clone_into(&new.sa, &state->sa);
+	stack_clone_into(&new.sb, &state->sb);
 
-	for (size_t i = 0; i < new.saves_size; ++i) {
-		int *data = xmalloc(new.sa.capacity * sizeof(int));
-		memcpy(data, state->saves[i].data, sizeof(int) * new.sa.capacity);
-		new.saves[i] = (save_t){
-			.data = data,
-			.sz_a = state->saves[i].sz_a,
-			.sz_b = state->saves[i].sz_b,
-			.op = state->saves[i].op,
-		};
-	}
+	state_copy_history(&new, state, state->saves_size);
 	return new;
 }
 
@@ -156,21 +336,19 @@ state_bifurcate(const state_t* state, size_t history)
 	assert(history < state->saves_size);
 
 	state_t new = {
-		.sa = stack_new(state->sa.capacity),
-		.sb = stack_new(state->sb.capacity),
-		.bifurcate_point = history,
-		.saves = xmalloc(sizeof(save_t) * history),
-		.saves_capacity = history,
-		.saves_size = history,
+		.bifurcate_point = SIZE_MAX,
+		.oplog = NULL,
+		.oplog_size = 0,
+		.oplog_capacity = 0,
+		.saves_size = 0,
+		.checkpoints = NULL,
+		.checkpoints_capacity = 0,
 		.op_count = state->op_count,
 		.search_depth = state->search_depth,
+		.undo_marks = 0,
 	};
-	memcpy(new.saves, state->saves, history * sizeof(save_t));
-	const save_t* save = &state->saves[history > 0 ? history - 1 : 0];
-	new.sa.size = save->sz_a;
-	new.sb.size = save->sz_b;
-	memcpy(new.sa.data, save->data, sizeof(int) * new.sa.size);
-	memcpy(new.sb.data, save->data + new.sa.size, sizeof(int) * new.sb.size);
+	state_new_stacks(&new, state->sa.capacity);
+	state_restore(&new, state, history > 0 ? history - 1 : 0);
 	return new;
 }
 
@@ -182,45 +360,106 @@ state_deep_bifurcate(const state_t* state, size_t history)
 	assert(history < state->saves_size);
 
 	state_t new = {
-		.sa = stack_new(state->sa.capacity),
-		.sb = stack_new(state->sb.capacity),
 		.bifurcate_point = 0,
-		.saves = xmalloc(sizeof(save_t) * history),
-		.saves_capacity = history,
-		.saves_size = history,
 		.op_count = state->op_count,
 		.search_depth = state->search_depth,
 	};
-	const save_t* save = &state->saves[history > 0 ? history - 1 : 0];
-	new.sa.size = save->sz_a;
-	new.sb.size = save->sz_b;
-	memcpy(new.sa.data, save->data, sizeof(int) * new.sa.size);
-	memcpy(new.sb.data, save->data + new.sa.size, sizeof(int) * new.sb.size);
-
-	for (size_t i = 0; i < new.saves_size; ++i) {
-		int *data = xmalloc(new.sa.capacity * sizeof(int));
-		memcpy(data, state->saves[i].data, sizeof(int) * new.sa.capacity);
-		new.saves[i] = (save_t){
-			.data = data,
-			.sz_a = state->saves[i].sz_a,
-			.sz_b = state->saves[i].sz_b,
-			.op = state->saves[i].op,
-		};
-	}
+	state_new_stacks(&new, state->sa.capacity);
+	state_restore(&new, state, history > 0 ? history - 1 : 0);
+	state_copy_history(&new, state, history);
 	return new;
 }
 
+void
+state_load_saves(const state_t* state, size_t history, size_t count, save_t* saves)
+{
+	assert(history + count <= state->saves_size);
+	if (!count)
+		return;
+
+	state_t replay = {
+		.bifurcate_point = SIZE_MAX,
+	};
+	state_new_stacks(&replay, state->sa.capacity);
+	state_restore(&replay, state, history);
+	size_t run, offset;
+	oplog_seek(state, history, &run, &offset);
+	for (size_t i = 0; i < count; ++i) {
+		const enum stack_op op = state->oplog[run].op;
+		if (i != 0)
+			state_op_raw(&replay, op);
+		save_store(&replay, &saves[i]);
+		saves[i].op = op;
+		if (++offset == state->oplog[run].count) {
+			++run;
+			offset = 0;
+		}
+	}
+	free(replay.sa.data);
+}
+
+void
+state_load_ops(const state_t* state, size_t history, size_t count, enum stack_op* ops)
+{
+	assert(history + count <= state->saves_size);
+	if (!count)
+		return;
+
+	size_t run, offset;
+	oplog_seek(state, history, &run, &offset);
+	for (size_t i = 0; i < count; ++run, offset = 0) {
+		const size_t n = state->oplog[run].count - offset < count - i
+		                   ? state->oplog[run].count - offset
+		                   : count - i;
+		for (size_t j = 0; j < n; ++j)
+			ops[i + j] = state->oplog[run].op;
+		i += n;
+	}
+}
+
+/**
+ * @brief Record @p count saves triggered by @p op
+ *
+ * The stacks must hold the last of these saves, so only it may be a checkpoint.
+ */
 static void
-state_add_save(state_t* state, enum stack_op op)
-{
-	save_t save = save_new(state);
-	save.op = op;
-	if (state->saves_size >= state->saves_capacity) {
-		const size_t capacity = state->saves_capacity * 2ul + !state->saves_capacity * 16ul;
-		state->saves = xrealloc(state->saves, capacity * sizeof(save_t));
-		state->saves_capacity = capacity;
+state_add_saves(state_t* state, enum stack_op op, size_t count)
+{
+	const size_t last = state->saves_size + count - 1;
+	assert(count != 0);
+	assert(last % STATE_CHECKPOINT_INTERVAL == 0 ||
+	       last / STATE_CHECKPOINT_INTERVAL == state->saves_size / STATE_CHECKPOINT_INTERVAL);
+
+	// Extend the last run, unless it ends with a checkpoint
+	op_run_t* const tail = state->oplog_size ? &state->oplog[state->oplog_size - 1] : NULL;
+	if (tail && tail->op == (uint32_t)op &&
+	    (state->saves_size - 1) % STATE_CHECKPOINT_INTERVAL != 0)
+		tail->count += (uint32_t)count & ((1u << 27) - 1);
+	else {
+		if (state->oplog_size >= state->oplog_capacity) {
+			const size_t capacity = state->oplog_capacity * 2ul + !state->oplog_capacity * 16ul;
+			state->oplog = xrealloc(state->oplog, capacity * sizeof(op_run_t));
+			state->oplog_capacity = capacity;
+		}
+		state->oplog[state->oplog_size++] = (op_run_t){
+			.op = (uint32_t)op & 0x1F,
+			.count = (uint32_t)count & ((1u << 27) - 1),
+		};
+	}
+	state->saves_size += count;
+
+	if (last % STATE_CHECKPOINT_INTERVAL == 0) {
+		const size_t checkpoint = last / STATE_CHECKPOINT_INTERVAL;
+		if (checkpoint >= state->checkpoints_capacity) {
+			const size_t capacity =
+			  state->checkpoints_capacity * 2ul + !state->checkpoints_capacity * 16ul;
+			state->checkpoints = xrealloc(state->checkpoints, capacity * sizeof(save_t));
+			state->checkpoints_capacity = capacity;
+		}
+		state->checkpoints[checkpoint] = save_new(state);
+		state->checkpoints[checkpoint].op = op;
+		state->checkpoints[checkpoint].run = state->oplog_size;
 	}
-	state->saves[state->saves_size++] = save;
 }
 
 const char*
@@ -236,68 +475,207 @@ op_name(enum stack_op op)
 	return table[op];
 }
 
+/* --- Operation kernels --- */
+
+/** @brief Swap the top 2 elements of @p s */
+static inline void
+stack_swap(stack_t* s)
+{
+	assert(s->size > 1);
+	const size_t tail = stack_index(s, 1);
+	const value_t tmp = s->data[s->head];
+	s->data[s->head] = s->data[tail];
+	s->data[tail] = tmp;
+	s->hash += (hash_value(s->data[s->head]) - hash_value(tmp)) * (1 - STACK_HASH_BASE);
+}
+
+/** @brief Move the top of @p from to the top of @p to */
+static inline void
+stack_push(stack_t* to, stack_t* from)
+{
+	assert(from->size);
+	const value_t tmp = from->data[from->head];
+	from->head = stack_index(from, 1);
+	--from->size;
+	to->head = to->head ? to->head - 1 : to->capacity - 1;
+	to->data[to->head] = tmp;
+	++to->size;
+	const uint64_t h = hash_value(tmp);
+	to->hash = h + to->hash * STACK_HASH_BASE;
+	to->weight *= STACK_HASH_BASE;
+	from->hash = (from->hash - h) * STACK_HASH_BASE_INV;
+	from->weight *= STACK_HASH_BASE_INV;
+}
+
+/** @brief Move the top of @p s to its bottom */
+static inline void
+stack_rotate(stack_t* s)
+{
+	assert(s->size);
+	const value_t tmp = s->data[s->head];
+	s->data[stack_index(s, s->size)] = tmp;
+	s->head = stack_index(s, 1);
+	const uint64_t h = hash_value(tmp);
+	s->hash = (s->hash - h + h * s->weight) * STACK_HASH_BASE_INV;
+}
+
+/** @brief Move the bottom of @p s to its top */
+static inline void
+stack_rev_rotate(stack_t* s)
+{
+	assert(s->size);
+	const value_t tmp = s->data[stack_index(s, s->size - 1)];
+	s->head = s->head ? s->head - 1 : s->capacity - 1;
+	s->data[s->head] = tmp;
+	const uint64_t h = hash_value(tmp);
+	s->hash = h + (s->hash - h * s->weight * STACK_HASH_BASE_INV) * STACK_HASH_BASE;
+}
+
+/** @brief Rotate @p s @p n times, in a single pass */
+static inline void
+stack_rotate_n(stack_t* s, size_t n)
+{
+	assert(s->size);
+	n %= s->size;
+
+	// Hash of the moved values, as a prefix of the stack
+	uint64_t moved = 0;
+	uint64_t pow = 1;
+	for (size_t i = 0; i < n; ++i) {
+		const value_t tmp = s->data[s->head];
+		s->data[stack_index(s, s->size)] = tmp;
+		s->head = stack_index(s, 1);
+		moved += hash_value(tmp) * pow;
+		pow *= STACK_HASH_BASE;
+	}
+	uint64_t inv = 1;
+	for (size_t i = 0; i < n; ++i)
+		inv *= STACK_HASH_BASE_INV;
+	s->hash = (s->hash - moved + moved * s->weight) * inv;
+}
+
+/** @brief Reverse-rotate @p s @p n times, in a single pass */
+static inline void
+stack_rev_rotate_n(stack_t* s, size_t n)
+{
+	assert(s->size);
+	n %= s->size;
+
+	// Hash of the moved values, as a prefix of the resulting stack
+	uint64_t moved = 0;
+	uint64_t pow = 1;
+	uint64_t inv = 1;
+	for (size_t i = 0; i < n; ++i) {
+		const value_t tmp = s->data[stack_index(s, s->size - 1)];
+		s->head = s->head ? s->head - 1 : s->capacity - 1;
+		s->data[s->head] = tmp;
+		moved = moved * STACK_HASH_BASE + hash_value(tmp);
+		pow *= STACK_HASH_BASE;
+		inv *= STACK_HASH_BASE_INV;
+	}
+	s->hash = moved + (s->hash - moved * s->weight * inv) * pow;
+}
+
+/** @brief Define the straight-line kernel of an operation */
+#define OP_KERNEL(name, ...)                                                                     \
+	static void op_##name(state_t* state)                                                        \
+	{                                                                                            \
+		__VA_ARGS__;                                                                             \
+	}
+
+OP_KERNEL(sa, stack_swap(&state->sa))
+OP_KERNEL(sb, stack_swap(&state->sb))
+OP_KERNEL(ss, stack_swap(&state->sa); stack_swap(&state->sb))
+OP_KERNEL(pa, stack_push(&state->sa, &state->sb))
+OP_KERNEL(pb, stack_push(&state->sb, &state->sa))
+OP_KERNEL(ra, stack_rotate(&state->sa))
+OP_KERNEL(rb, stack_rotate(&state->sb))
+OP_KERNEL(rr, stack_rotate(&state->sa); stack_rotate(&state->sb))
+OP_KERNEL(rra, stack_rev_rotate(&state->sa))
+OP_KERNEL(rrb, stack_rev_rotate(&state->sb))
+OP_KERNEL(rrr, stack_rev_rotate(&state->sa); stack_rev_rotate(&state->sb))
+OP_KERNEL(nop, (void)state)
+
+#undef OP_KERNEL
+
+/** @brief Kernel of every operation, indexed by @ref stack_op */
+static void (*const op_kernels[STACK_OPERATOR__ + STACK_OPERAND__ + 1])(state_t*) = {
+	[STACK_OP_SA] = op_sa,   [STACK_OP_SB] = op_sb,   [STACK_OP_SS] = op_ss,
+	[STACK_OP_PA] = op_pa,   [STACK_OP_PB] = op_pb,   [STACK_OP_RA] = op_ra,
+	[STACK_OP_RB] = op_rb,   [STACK_OP_RR] = op_rr,   [STACK_OP_RRA] = op_rra,
+	[STACK_OP_RRB] = op_rrb, [STACK_OP_RRR] = op_rrr, [STACK_OP_NOP] = op_nop,
+};
+
 static inline void
 state_op_raw(state_t* state, enum stack_op op)
 {
 	assert(state->sa.capacity == state->sb.capacity);
 	assert(state->sa.size + state->sb.size == state->sa.capacity);
+	assert((size_t)op < sizeof(op_kernels) / sizeof(op_kernels[0]) && op_kernels[op]);
 
 	++state->op_count;
-	int tmp;
-	stack_t* const s[2] = { &state->sa, &state->sb };
-	for (unsigned int i = 0; i < 2; ++i) {
-		if (!((op & STACK_OPERAND__) & (i + 1)))
-			continue;
-		switch (op & STACK_OPERATOR__) {
-			case STACK_OP_SWAP__:
-				assert(s[i]->size > 1);
-				tmp = s[i]->data[0];
-				s[i]->data[0] = s[i]->data[1];
-				s[i]->data[1] = tmp;
-				break;
-			case STACK_OP_PUSH__:
-				assert(s[!i]->size);
-				if (s[i]->data - 1 <= s[i]->start) {
-					memcpy(
-					  (int*)s[i]->start + s[i]->capacity, s[i]->data, s[i]->size * sizeof(int));
-					s[i]->data = (int*)s[i]->start + s[i]->capacity;
-				}
-				--s[i]->data;
-				++s[i]->size;
-				s[i]->data[0] = s[!i]->data[0];
-				++s[!i]->data;
-				--s[!i]->size;
-				break;
-			case STACK_OP_ROTATE__:
-				assert(s[i]->size);
-				tmp = s[i]->data[0];
-				if (s[i]->data + 1 >= s[i]->start + 2 * s[i]->capacity) {
-					memcpy(
-					  (int*)s[i]->start + s[i]->capacity, s[i]->data, s[i]->size * sizeof(int));
-					s[i]->data = (int*)s[i]->start + s[i]->capacity;
-				}
-				++s[i]->data;
-				s[i]->data[s[i]->size - 1] = tmp;
-				break;
-			case STACK_OP_REV_ROTATE__:
-				assert(s[i]->size);
-				tmp = s[i]->data[s[i]->size - 1];
-				if (s[i]->data - 1 <= s[i]->start) {
-					memcpy(
-					  (int*)s[i]->start + s[i]->capacity, s[i]->data, s[i]->size * sizeof(int));
-					s[i]->data = (int*)s[i]->start + s[i]->capacity;
-				}
-				--s[i]->data;
-				s[i]->data[0] = tmp;
-				break;
-			case STACK_OP_NOP__:
-				assert(0); /* NOP takes no operands */
-				__builtin_unreachable();
-			default:
-				assert(0);
-				__builtin_unreachable();
-		}
+	op_kernels[op](state);
+}
+
+static inline void
+state_op_n_raw(state_t* state, enum stack_op op, size_t count)
+{
+	assert((size_t)op < sizeof(op_kernels) / sizeof(op_kernels[0]) && op_kernels[op]);
+
+	state->op_count += count;
+	switch (op & STACK_OPERATOR__) {
+		case STACK_OP_ROTATE__:
+			if (op & STACK_OP_SEL_A__)
+				stack_rotate_n(&state->sa, count);
+			if (op & STACK_OP_SEL_B__)
+				stack_rotate_n(&state->sb, count);
+			break;
+		case STACK_OP_REV_ROTATE__:
+			if (op & STACK_OP_SEL_A__)
+				stack_rev_rotate_n(&state->sa, count);
+			if (op & STACK_OP_SEL_B__)
+				stack_rev_rotate_n(&state->sb, count);
+			break;
+		default:
+			for (size_t i = 0; i < count; ++i)
+				op_kernels[op](state);
+			break;
+	}
+}
+
+/** @brief Per-thread log of the operations applied to marked states */
+static _Thread_local struct
+{
+	/** @brief Logged operations */
+	enum stack_op* ops;
+	/** @brief Number of logged operations */
+	size_t size;
+	/** @brief Capacity of `ops` */
+	size_t capacity;
+} undo_log = { NULL, 0, 0 };
+
+/** @brief Release the calling thread's undo log */
+static void
+undo_log_free(void)
+{
+	free(undo_log.ops);
+	undo_log.ops = NULL;
+	undo_log.size = undo_log.capacity = 0;
+}
+
+/** @brief Record @p count applications of @p op in the thread's undo log */
+static inline void
+undo_log_push(enum stack_op op, size_t count)
+{
+	if (undo_log.size + count > undo_log.capacity) {
+		if (!undo_log.ops)
+			thread_at_exit(undo_log_free);
+		while (undo_log.size + count > undo_log.capacity)
+			undo_log.capacity = undo_log.capacity ? undo_log.capacity * 2 : 1024;
+		undo_log.ops = xrealloc(undo_log.ops, sizeof(enum stack_op) * undo_log.capacity);
 	}
+	for (size_t i = 0; i < count; ++i)
+		undo_log.ops[undo_log.size++] = op;
 }
 
 void
@@ -306,57 +684,100 @@ state_op(state_t* state, enum stack_op op)
 	state_op_raw(state, op);
 
 	if (state->bifurcate_point == 0)
-		state_add_save(state, op);
+		state_add_saves(state, op, 1);
+	if (state->undo_marks)
+		undo_log_push(op, 1);
 }
 
-inline void
-state_undo(state_t* state, enum stack_op op)
+void
+state_op_n(state_t* state, enum stack_op op, size_t count)
+{
+	while (count) {
+		size_t n = count;
+		// Stop at the next checkpoint, which must be recorded from its own stacks
+		if (state->bifurcate_point == 0) {
+			const size_t next = (state->saves_size + STATE_CHECKPOINT_INTERVAL - 1) /
+			                    STATE_CHECKPOINT_INTERVAL * STATE_CHECKPOINT_INTERVAL;
+			if (next - state->saves_size + 1 < n)
+				n = next - state->saves_size + 1;
+		}
+
+		state_op_n_raw(state, op, n);
+		if (state->bifurcate_point == 0)
+			state_add_saves(state, op, n);
+		if (state->undo_marks)
+			undo_log_push(op, n);
+		count -= n;
+	}
+}
+
+/** @brief Inverse of an operation */
+static inline enum stack_op
+op_inverse(enum stack_op op)
 {
-	assert(state->op_count != 0);
 	switch (op) {
 		case STACK_OP_PA:
-			op = STACK_OP_PB;
-			break;
+			return STACK_OP_PB;
 		case STACK_OP_PB:
-			op = STACK_OP_PA;
-			break;
+			return STACK_OP_PA;
 		case STACK_OP_RA:
-			op = STACK_OP_RRA;
-			break;
+			return STACK_OP_RRA;
 		case STACK_OP_RB:
-			op = STACK_OP_RRB;
-			break;
+			return STACK_OP_RRB;
 		case STACK_OP_RR:
-			op = STACK_OP_RRR;
-			break;
+			return STACK_OP_RRR;
 		case STACK_OP_RRA:
-			op = STACK_OP_RA;
-			break;
+			return STACK_OP_RA;
 		case STACK_OP_RRB:
-			op = STACK_OP_RB;
-			break;
+			return STACK_OP_RB;
 		case STACK_OP_RRR:
-			op = STACK_OP_RR;
-			break;
+			return STACK_OP_RR;
 		default:
-			break;
+			return op;
 	}
+}
+
+void
+state_undo(state_t* state, enum stack_op op)
+{
+	assert(state->op_count != 0);
 	--state->op_count;
-	state_op_raw(state, op);
+	state_op_raw(state, op_inverse(op));
 	--state->op_count;
 }
 
+state_mark_t
+state_mark(state_t* state)
+{
+	++state->undo_marks;
+	return (state_mark_t){
+		.undo_size = undo_log.size,
+		.op_count = state->op_count,
+	};
+}
+
+void
+state_rollback(state_t* state, state_mark_t mark)
+{
+	assert(state->undo_marks != 0);
+	assert(mark.undo_size <= undo_log.size);
+	while (undo_log.size > mark.undo_size)
+		state_op_raw(state, op_inverse(undo_log.ops[--undo_log.size]));
+	state->op_count = mark.op_count;
+	--state->undo_marks;
+}
+
 void
 print_state(const state_t* s)
 {
 	printf(" A | B\n");
 	for (size_t i = 0; i < s->sa.size || i < s->sb.size; ++i) {
 		if (i < s->sa.size)
-			printf("%-3d|", s->sa.data[i]);
+			printf("%-3u|", (unsigned)stack_get(&s->sa, i));
 		else
 			printf("   |");
 		if (i < s->sb.size)
-			printf("%3d", s->sb.data[i]);
+			printf("%3u", (unsigned)stack_get(&s->sb, i));
 		printf("\n");
 	}
 }
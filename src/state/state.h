@@ -27,9 +27,8 @@
  *
  * # Implementation
  *
- * All operations are trivially O(1), except for rotations. By using a deque as
- * the stack, we can amortize the expensive `memcopy` that will happens around
- * every N rotate operations. Therefore rotations are amortized O(1).
+ * All operations are O(1): stacks are ring buffers (see @ref stack_t), so rotations
+ * only write the rotated element and move the stack's head.
  */
 enum stack_op
 {
@@ -136,48 +135,126 @@ op_name(enum stack_op op);
 
 typedef struct state_t state_t;
 
+/**
+ * @brief A value in the stacks
+ *
+ * Input values are only ever compared, so they are replaced by their rank in the input
+ * (`0..N-1`) before sorting. Building with `PUSH_META_NARROW_VALUES` stores them on 16
+ * bits, which halves the memory traffic of clones, saves and comparisons but limits
+ * inputs to `VALUE_MAX` values.
+ */
+#ifdef PUSH_META_NARROW_VALUES
+typedef uint16_t value_t;
+#else
+typedef uint32_t value_t;
+#endif
+/** @brief Largest value, never a rank: inputs may hold at most `VALUE_MAX` values */
+#define VALUE_MAX ((value_t) ~(value_t)0)
+
 /**
  * @brief The stack data structure
  *
  * The instructions set requires underlying stacks to be implemented. They are called
  * `stacks` however they act as double-ended queue because of the
  * (reverse-)rotate operations. Since the stacks cannot grow (limited to the
- * initial program input size), the stacks are implemented using a double-ended queue
- * with a static capacity of 3*N (N = input size). The initial buffer is contained
- * within [N, 2N], and will move with pushes, rotates and reverse-rotates. Once
- * it reaches the edges, [0, N] or [2N, 3N], if will be copied back to the
- * center position. Using a 3*N factor allows the use of `memcpy` when re-centering the values,
- * instead of `memmove`. This guarantees that every operation is amortized O(1).
- *
+ * initial program input size N), each stack is a ring buffer of N elements. Both rings
+ * live in the same allocation (see @ref state_t). Pushes move one element and the
+ * heads, rotations write a single element and move the head: every operation is O(1),
+ * without ever re-centering the values.
  */
 typedef struct
 {
-	/** Start address of the stack */
-	int* start;
-	/** @brief Stack elements, within `[start, start + 2 * capacity]` */
-	int* data;
+	/** @brief Ring buffer of `capacity` elements */
+	value_t* data;
+	/** @brief Index of the stack's top within `data` */
+	size_t head;
 	/** @brief Number of elements in the stack */
 	size_t size;
 	/* guard */
 	size_t capacity;
+	/** @brief Rolling hash of the stack, see @ref stack_append */
+	uint64_t hash;
+	/** @brief `STACK_HASH_BASE^size`, weight of the next bottom element */
+	uint64_t weight;
 } stack_t;
 
 /**
- * @brief Create a new stack with an initial capacity
+ * @brief Base of the rolling stack hash
+ *
+ * A stack `[v_0, ..., v_n-1]` (top first) hashes to `sum(mix(v_i) * BASE^i)` modulo
+ * 2^64. The base is odd, hence invertible, which lets pushes, pops and rotations at
+ * either end update the hash in O(1).
+ */
+#define STACK_HASH_BASE 0x100000001B3ull
+/** @brief Inverse of @ref STACK_HASH_BASE modulo 2^64 */
+#define STACK_HASH_BASE_INV 0xCE965057AFF6957Bull
+
+/**
+ * @brief Create a new empty stack
  *
+ * @param data Buffer of @p capacity elements, used as the stack's ring
  * @param capacity Capacity of the stack
  *
  * @return A new stack that can hold @p capacity elements
  */
 stack_t
-stack_new(size_t capacity);
+stack_new(value_t* data, size_t capacity);
+/**
+ * @brief Index of a stack position within the stack's ring
+ *
+ * @param stack Stack
+ * @param pos Position from the top, `pos <= capacity`
+ *
+ * @return The index of @p pos in `stack->data`
+ */
+static inline size_t
+stack_index(const stack_t* stack, size_t pos)
+{
+	const size_t idx = stack->head + pos;
+	return idx >= stack->capacity ? idx - stack->capacity : idx;
+}
+/**
+ * @brief Get a value from a stack
+ *
+ * @param stack Stack
+ * @param pos Position from the top
+ *
+ * @return The value at @p pos in @p stack
+ */
+static inline value_t
+stack_get(const stack_t* stack, size_t pos)
+{
+	assert(pos < stack->size);
+	return stack->data[stack_index(stack, pos)];
+}
+/**
+ * @brief Append a value at the bottom of a stack
+ *
+ * This is how stacks are initially filled, it keeps the stack's hash up to date.
+ *
+ * @param stack Stack to append to
+ * @param value Value to append
+ */
+void
+stack_append(stack_t* stack, value_t value);
 /**
- * @brief Destroy (deallocate) a stack
+ * @brief Copy the values of a stack, top first
  *
- * @param stack Stack to deallocate
+ * @param stack Stack to copy
+ * @param out Destination buffer of at least `stack->size` elements
  */
 void
-stack_destroy(stack_t* stack);
+stack_copy(const stack_t* stack, value_t* out);
+/**
+ * @brief Compare a stack with a list of values, top first
+ *
+ * @param stack Stack to compare
+ * @param values List of `stack->size` values
+ *
+ * @return 1 if @p stack holds @p values, `0` otherwise
+ */
+int
+stack_equal(const stack_t* stack, const value_t* values);
 /**
  * @brief Check if a stack is sorted
  *
@@ -188,22 +265,53 @@ stack_destroy(stack_t* stack);
 int
 stack_is_sorted(const stack_t *stack);
 
+/**
+ * @brief Number of saves between two checkpoints of the save log
+ *
+ * Saves are not stored individually: the state keeps a log of the operations that
+ * triggered each save, and a full snapshot (checkpoint) every
+ * `STATE_CHECKPOINT_INTERVAL` saves. A save is reconstructed by replaying the log from
+ * the nearest checkpoint, making the history `O(ops + ops / K * N)` in memory.
+ */
+#define STATE_CHECKPOINT_INTERVAL 256
+
+/**
+ * @brief A run of identical operations in the op log
+ *
+ * The log is run-length encoded, runs never span a checkpoint: replaying from a
+ * checkpoint always starts at the beginning of a run. A run is no larger than a single
+ * operation, so the log never takes more memory than a plain list of operations.
+ */
+typedef struct
+{
+	/** @brief Operation, see @ref stack_op */
+	uint32_t op : 5;
+	/** @brief Number of consecutive saves triggered by `op` */
+	uint32_t count : 27;
+} op_run_t;
+
 /**
  * @brief Store a save of state
  *
  * In regular evaluation mode, every operation adds a save to the state.
- * This is how @ref state_bifurcate can restore a previous saved state
+ * This is how @ref state_bifurcate can restore a previous saved state.
+ * Saves are only materialized for checkpoints, or when requested with
+ * @ref state_load_saves.
  */
 typedef struct
 {
 	/** @brief Saved values, layout: [stack_a, stack_b] */
-	int* data;
+	value_t* data;
 	/** @brief Size of stack_a */
 	size_t sz_a;
 	/** @brief Size of stack_b */
 	size_t sz_b;
 	/** @brief Operation that triggered the save */
 	enum stack_op op;
+	/** @brief Hash of the saved state, see @ref state_hash */
+	uint64_t hash;
+	/** @brief For checkpoints, index of the op log run holding the next save */
+	size_t run;
 } save_t;
 
 /**
@@ -228,26 +336,48 @@ save_destroy(save_t* save);
  */
 typedef struct state_t
 {
-	/** @brief A stack */
+	/** @brief A stack, `sa.data` is the allocation holding both stacks */
 	stack_t sa;
-	/** @brief B stack */
+	/** @brief B stack, `sb.data` follows `sa`'s ring */
 	stack_t sb;
 
-	/** @brief All saves */
-	save_t* saves;
+	/** @brief Operation log, runs of the operations that triggered each save */
+	op_run_t* oplog;
+	/** @brief Number of runs in `oplog` */
+	size_t oplog_size;
+	/** @brief Capacity of `oplog` */
+	size_t oplog_capacity;
 	/** @brief Number of saves */
 	size_t saves_size;
-	/** @brief Capacity of `saves` */
-	size_t saves_capacity;
-	/** @brief Point of bifurcation, `SIZE_MAX` for none */
+	/** @brief Checkpoints, `checkpoints[j]` is save `j * STATE_CHECKPOINT_INTERVAL` */
+	save_t* checkpoints;
+	/** @brief Capacity of `checkpoints` */
+	size_t checkpoints_capacity;
+	/** @brief `0` if the state records saves, `SIZE_MAX` for states without history */
 	size_t bifurcate_point;
 
 	/** @brief Number of operations evaluated */
 	size_t op_count;
 	/** @brief Search depth, used by Nelder-Maud to preemptively stop */
 	size_t search_depth;
+	/** @brief Number of open marks, see @ref state_mark */
+	size_t undo_marks;
 } state_t;
 
+/**
+ * @brief A rollback point of a state
+ *
+ * While a state has open marks, every operation applied to it is recorded in the
+ * calling thread's undo log, so that @ref state_rollback can rewind them in place.
+ */
+typedef struct
+{
+	/** @brief Size of the thread's undo log when the mark was taken */
+	size_t undo_size;
+	/** @brief Operation count when the mark was taken */
+	size_t op_count;
+} state_mark_t;
+
 /**
  * @brief Create a new state
  *
@@ -257,6 +387,19 @@ typedef struct state_t
  */
 state_t
 state_new(size_t capacity);
+/**
+ * @brief Create a new scratch state
+ *
+ * @param capacity Capacity of the state's stacks
+ *
+ * @return The newly created state
+ *
+ * @note Like clones, the returned state will not record saves. Its stacks are
+ * allocated from the calling thread's arena: it must not be destroyed, and is released
+ * by @ref arena_reset.
+ */
+state_t
+state_scratch(size_t capacity);
 /**
  * @brief Destroy (deallocate) a state
  *
@@ -267,17 +410,72 @@ state_destroy(state_t *state);
 /**
  * @brief Create a state from a save state
  *
+ * Only the stacks are restored, by replaying the log from the nearest checkpoint: this
+ * is `O(N + STATE_CHECKPOINT_INTERVAL)`, regardless of @p history.
+ *
  * @param state State to use for save states
  * @param history Save state ID
  *
  * @return The newly created state.
  *
- * @note The returned state is special in that it won't create new save states when used.
+ * @note The returned state is special in that it carries no history and won't create
+ * new save states when used.
  */
 state_t
 state_bifurcate(const state_t* state, size_t history);
+/**
+ * @brief Create a recording state from a save state
+ *
+ * Unlike @ref state_bifurcate, the returned state records saves, and starts with a copy
+ * of the first @p history saves of @p state (log prefix and covered checkpoints).
+ *
+ * @param state State to use for save states
+ * @param history Save state ID
+ *
+ * @return The newly created state.
+ */
 state_t
 state_deep_bifurcate(const state_t* state, size_t history);
+/**
+ * @brief Reconstruct consecutive saves from the save log
+ *
+ * Saves `[history, history + count)` are rebuilt by replaying the log from the
+ * checkpoint preceding @p history.
+ *
+ * @param state State holding the save log
+ * @param history First save ID
+ * @param count Number of saves to reconstruct
+ * @param saves Destination saves, each `data` must hold the state's capacity
+ */
+void
+state_load_saves(const state_t* state, size_t history, size_t count, save_t* saves);
+/**
+ * @brief Decode consecutive operations from the save log
+ *
+ * @param state State holding the save log
+ * @param history First save ID
+ * @param count Number of operations to decode
+ * @param ops Destination of the operations that triggered saves
+ * `[history, history + count)`
+ */
+void
+state_load_ops(const state_t* state, size_t history, size_t count, enum stack_op* ops);
+/**
+ * @brief Hash of both stacks of a state
+ *
+ * @param state State to hash
+ *
+ * @return A hash of @p state, maintained in O(1) for every operation
+ */
+static inline uint64_t
+state_hash(const state_t* state)
+{
+	uint64_t h = state->sa.hash ^ (state->sb.hash * 0x9E3779B97F4A7C15ull) ^ state->sa.size;
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDull;
+	h ^= h >> 33;
+	return h;
+}
 /**
  * @brief Evaluate an operation on the state
  *
@@ -288,6 +486,19 @@ state_deep_bifurcate(const state_t* state, size_t history);
  */
 void
 state_op(state_t* state, enum stack_op op);
+/**
+ * @brief Evaluate an operation multiple times on the state
+ *
+ * Runs of rotations are applied at once: each stack moves its head and the rotated
+ * values in a single pass, and the saves are recorded as a single run of the op log.
+ *
+ * @param op Operation to evaluate
+ * @param count Number of times to evaluate @p op
+ *
+ * @note Equivalent to calling @ref state_op @p count times.
+ */
+void
+state_op_n(state_t* state, enum stack_op op, size_t count);
 /**
  * @brief Undo an operation on the state
  *
@@ -301,6 +512,31 @@ state_op(state_t* state, enum stack_op op);
  */
 void
 state_undo(state_t* state, enum stack_op op);
+/**
+ * @brief Start recording the operations applied to a state
+ *
+ * This lets the caller evaluate a sequence of operations on a working state, and undo
+ * them with @ref state_rollback instead of cloning the state beforehand.
+ *
+ * @param state State to mark
+ *
+ * @return A mark to rollback to
+ *
+ * @note Marks must be rolled back in LIFO order, on the thread that took them. Marked
+ * states should not record saves.
+ */
+state_mark_t
+state_mark(state_t* state);
+/**
+ * @brief Undo every operation applied to a state since a mark
+ *
+ * @param state State to rollback
+ * @param mark Mark returned by @ref state_mark for @p state
+ *
+ * @note This closes @p mark and restores @p state's op_count.
+ */
+void
+state_rollback(state_t* state, state_mark_t mark);
 /**
  * @brief Clone the state
  *
@@ -1,4 +1,7 @@
 #include "util.h"
+#include <pthread.h>
+#include <stdalign.h>
+#include <stddef.h>
 
 void*
 xmalloc(size_t size)
@@ -20,3 +23,127 @@ void
 		abort();
 	return new;
 }
+
+/* --- Thread exit --- */
+
+/** @brief Functions to call when the calling thread exits */
+static _Thread_local struct
+{
+	void (*fns[THREAD_AT_EXIT_MAX])(void);
+	size_t size;
+} thread_exit = { { NULL }, 0 };
+
+/** @brief Key whose destructor runs @ref thread_exit's functions */
+static pthread_key_t thread_exit_key;
+static pthread_once_t thread_exit_once = PTHREAD_ONCE_INIT;
+
+static void
+thread_exit_run(void* unused)
+{
+	(void)unused;
+	while (thread_exit.size)
+		thread_exit.fns[--thread_exit.size]();
+}
+
+static void
+thread_exit_init(void)
+{
+	if (pthread_key_create(&thread_exit_key, thread_exit_run))
+		abort();
+}
+
+void
+thread_at_exit(void (*fn)(void))
+{
+	assert(thread_exit.size < THREAD_AT_EXIT_MAX);
+	pthread_once(&thread_exit_once, thread_exit_init);
+	// Destructors only run for keys holding a non-NULL value
+	if (thread_exit.size == 0 && pthread_setspecific(thread_exit_key, &thread_exit))
+		abort();
+	thread_exit.fns[thread_exit.size++] = fn;
+}
+
+/* --- Arena --- */
+
+/** @brief Minimum size of an arena chunk */
+#define ARENA_CHUNK_SIZE (1ul << 20)
+
+struct arena_chunk
+{
+	/** @brief Next chunk, reused once this one is full */
+	struct arena_chunk* next;
+	/** @brief Capacity of `data` */
+	size_t size;
+	/** @brief Bytes used in `data` */
+	size_t used;
+	alignas(max_align_t) unsigned char data[];
+};
+
+/** @brief Per-thread arena */
+static _Thread_local struct
+{
+	/** @brief First chunk */
+	struct arena_chunk* first;
+	/** @brief Chunk allocations are made from */
+	struct arena_chunk* current;
+} arena = { NULL, NULL };
+
+/** @brief Return the calling thread's chunks to `malloc` */
+static void
+arena_free(void)
+{
+	while (arena.first) {
+		struct arena_chunk* const next = arena.first->next;
+		free(arena.first);
+		arena.first = next;
+	}
+	arena.current = NULL;
+}
+
+void*
+arena_alloc(size_t size)
+{
+	size = (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+	struct arena_chunk* chunk = arena.current;
+	if (!chunk || chunk->size - chunk->used < size) {
+		// Reuse the next chunk if it is large enough, otherwise insert a new one
+		struct arena_chunk* next = chunk ? chunk->next : arena.first;
+		if (next && next->size >= size)
+			chunk = next;
+		else {
+			const size_t chunk_size = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+			struct arena_chunk* new = xmalloc(sizeof(struct arena_chunk) + chunk_size);
+			new->next = next;
+			new->size = chunk_size;
+			if (!arena.first)
+				thread_at_exit(arena_free);
+			if (chunk)
+				chunk->next = new;
+			else
+				arena.first = new;
+			chunk = new;
+		}
+		chunk->used = 0;
+		arena.current = chunk;
+	}
+	void* const ptr = chunk->data + chunk->used;
+	chunk->used += size;
+	return ptr;
+}
+
+arena_mark_t
+arena_mark(void)
+{
+	return (arena_mark_t){
+		.chunk = arena.current,
+		.used = arena.current ? arena.current->used : 0,
+	};
+}
+
+void
+arena_reset(arena_mark_t mark)
+{
+	arena.current = mark.chunk;
+	if (mark.chunk)
+		mark.chunk->used = mark.used;
+}
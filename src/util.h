@@ -9,4 +9,58 @@ xmalloc(size_t size);
 void*
 xrealloc(void *ptr, size_t size);
 
+/**
+ * @brief A position in the calling thread's arena
+ *
+ * Every thread owns a bump allocator made of chunks that are only returned to `malloc`
+ * when the thread exits (see @ref thread_at_exit). Allocations are released in LIFO
+ * order by resetting the arena to a mark taken before them, which makes search-time
+ * scratch memory free of allocator contention between threads.
+ */
+typedef struct
+{
+	/** @brief Chunk that was current when the mark was taken, `NULL` for an empty arena */
+	struct arena_chunk* chunk;
+	/** @brief Bytes used in `chunk` */
+	size_t used;
+} arena_mark_t;
+
+/**
+ * @brief Allocate from the calling thread's arena
+ *
+ * @param size Number of bytes to allocate
+ *
+ * @return A pointer aligned for any type, valid until the arena is reset to a mark
+ * taken before this call
+ */
+void*
+arena_alloc(size_t size);
+/**
+ * @brief Get the current position in the calling thread's arena
+ */
+arena_mark_t
+arena_mark(void);
+/**
+ * @brief Release every allocation made by the calling thread since @p mark
+ *
+ * @param mark Mark returned by @ref arena_mark on the same thread
+ */
+void
+arena_reset(arena_mark_t mark);
+
+/** @brief Most functions a thread can register with @ref thread_at_exit */
+#define THREAD_AT_EXIT_MAX 4
+
+/**
+ * @brief Call @p fn when the calling thread exits
+ *
+ * Thread-local buffers are released this way, as OpenMP retires the workers of teams
+ * that shrink. Functions registered by the main thread are never called, its buffers
+ * are released with the process.
+ *
+ * @param fn Function to call on the exiting thread, at most once per thread
+ */
+void
+thread_at_exit(void (*fn)(void));
+
 #endif // UTIL_H
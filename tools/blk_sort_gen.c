@@ -0,0 +1,212 @@
+/*
+ * Generates `src/quicksort/sort_tables.h`, the shortest operation sequences sorting
+ * every block of 2 to `BLK_SORT_MAX` values onto A's top, from every location, in the
+ * wall model (see `src/quicksort/model.h`).
+ *
+ * Every operation has an inverse, so the search graph is undirected: a single BFS from
+ * the sorted state gives the distance of every state, and sequences are rebuilt by
+ * following decreasing distances.
+ *
+ * With `pdb`, writes the pattern database of @ref blk_sort_ida instead: the distance of
+ * every model state of `BLK_SORT_MAX + 1` to `BLK_PDB_SIZE` values, one byte per state
+ * after a @ref blk_pdb_header_t.
+ *
+ * Usage: blk_sort_gen > src/quicksort/sort_tables.h
+ *        blk_sort_gen pdb > blk_sort.pdb
+ */
+#include <quicksort/model.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/** @brief Permutation of `0..n-1` of Lehmer rank @p rank */
+static void
+perm_unrank(size_t rank, size_t n, uint8_t* perm)
+{
+	uint8_t used[BLK_IDA_MAX] = { 0 };
+	for (size_t i = 0; i < n; ++i) {
+		size_t smaller = rank / model_factorial(n - i - 1);
+		rank %= model_factorial(n - i - 1);
+		size_t v = 0;
+		while (used[v] || smaller) {
+			smaller -= !used[v];
+			++v;
+		}
+		perm[i] = (uint8_t)v;
+		used[v] = 1;
+	}
+}
+
+/** @brief Model state of @p n values of index @p index, see @ref model_index */
+static model_t
+model_state(size_t index, size_t n)
+{
+	uint8_t perm[BLK_IDA_MAX];
+	perm_unrank(index % model_factorial(n), n, perm);
+	size_t sizes = index / model_factorial(n);
+
+	model_t m;
+	size_t len = 0;
+	for (size_t s = 0; s < SEG_COUNT; ++s) {
+		size_t size = 0;
+		if (s + 1 == SEG_COUNT)
+			size = n - len;
+		else
+			while (sizes >= model_compositions(n - len - size, SEG_COUNT - s - 1))
+				sizes -= model_compositions(n - len - size++, SEG_COUNT - s - 1);
+		memcpy(m.seg[s], perm + len, size);
+		m.size[s] = (uint8_t)size;
+		len += size;
+	}
+	return m;
+}
+
+/** @brief Distance to the sorted state of every model state of @p n values */
+static uint8_t*
+bfs(size_t n)
+{
+	const size_t states = model_states(n);
+	uint8_t* dist = malloc(states);
+	memset(dist, UINT8_MAX, states);
+
+	// States are queued by index, which takes a fraction of the memory of states
+	uint32_t* queue = malloc(sizeof(uint32_t) * states);
+	size_t head = 0;
+	size_t tail = 0;
+	model_t sorted;
+	memset(&sorted, 0, sizeof(sorted));
+	for (size_t i = 0; i < n; ++i)
+		sorted.seg[SEG_A_TOP][i] = (uint8_t)i;
+	sorted.size[SEG_A_TOP] = (uint8_t)n;
+	queue[tail] = (uint32_t)model_index(&sorted, n);
+	dist[queue[tail++]] = 0;
+
+	while (head < tail) {
+		const model_t cur = model_state(queue[head], n);
+		const uint8_t d = dist[queue[head++]];
+		for (size_t i = 0; i < MODEL_OPS_LEN; ++i) {
+			model_t next = cur;
+			if (!model_apply(&next, model_ops[i]))
+				continue;
+			const size_t index = model_index(&next, n);
+			if (dist[index] != UINT8_MAX)
+				continue;
+			dist[index] = (uint8_t)(d + 1);
+			queue[tail++] = (uint32_t)index;
+		}
+	}
+	free(queue);
+	return dist;
+}
+
+/** @brief Write the pattern database to stdout */
+static int
+write_pdb(void)
+{
+	size_t states = 0;
+	for (size_t n = BLK_SORT_MAX + 1; n <= BLK_PDB_SIZE; ++n)
+		states += model_states(n);
+	blk_pdb_header_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, BLK_PDB_MAGIC, sizeof(header.magic));
+	header.size = BLK_PDB_SIZE;
+	header.states = (uint32_t)states;
+	int ok = fwrite(&header, sizeof(header), 1, stdout) == 1;
+	for (size_t n = BLK_SORT_MAX + 1; ok && n <= BLK_PDB_SIZE; ++n) {
+		uint8_t* dist = bfs(n);
+		ok = fwrite(dist, 1, model_states(n), stdout) == model_states(n);
+		free(dist);
+	}
+	if (!ok) {
+		fprintf(stderr, "blk_sort_gen: failed to write the pattern database\n");
+		return 1;
+	}
+	return 0;
+}
+
+int
+main(int ac, char** av)
+{
+	if (ac == 2 && !strcmp(av[1], "pdb"))
+		return write_pdb();
+
+	static const char* dest_names[4] = {
+		[BLK_A_TOP] = "BLK_A_TOP",
+		[BLK_A_BOT] = "BLK_A_BOT",
+		[BLK_B_TOP] = "BLK_B_TOP",
+		[BLK_B_BOT] = "BLK_B_BOT",
+	};
+	static uint8_t seq[64 * 1024];
+	static uint16_t index[BLK_SORT_MAX + 1][4][720];
+	size_t seq_len = 0;
+	size_t longest = 0;
+
+	for (size_t n = 2; n <= BLK_SORT_MAX; ++n) {
+		uint8_t* dist = bfs(n);
+		for (size_t dest = 0; dest < 4; ++dest) {
+			for (size_t rank = 0; rank < model_factorial(n); ++rank) {
+				uint8_t perm[BLK_SORT_MAX];
+				perm_unrank(rank, n, perm);
+
+				// Follow decreasing distances
+				index[n][dest][rank] = (uint16_t)seq_len;
+				model_t m = model_block(perm, n, (enum blk_dest)dest);
+				size_t d = dist[model_index(&m, n)];
+				if (d > longest)
+					longest = d;
+				while (d != 0) {
+					for (size_t i = 0; i < MODEL_OPS_LEN; ++i) {
+						model_t next = m;
+						if (!model_apply(&next, model_ops[i]) || dist[model_index(&next, n)] != d - 1)
+							continue;
+						seq[seq_len++] = (uint8_t)model_ops[i];
+						m = next;
+						--d;
+						break;
+					}
+				}
+				seq[seq_len++] = (uint8_t)STACK_OP_NOP;
+			}
+		}
+		free(dist);
+	}
+	if (seq_len > UINT16_MAX) {
+		fprintf(stderr, "blk_sort_gen: sequences do not fit 16-bit offsets\n");
+		return 1;
+	}
+
+	printf("/* Generated by tools/blk_sort_gen.c, do not edit */\n"
+	       "#ifndef SORT_TABLES_H\n"
+	       "#define SORT_TABLES_H\n"
+	       "\n"
+	       "#include <stdint.h>\n"
+	       "\n"
+	       "/** @brief Longest sequence in @ref blk_sort_ops */\n"
+	       "#define BLK_SORT_LONGEST %zu\n"
+	       "\n"
+	       "/** @brief `STACK_OP_NOP` terminated operation sequences */\n"
+	       "static const uint8_t blk_sort_ops[%zu] = {",
+	       longest,
+	       seq_len);
+	for (size_t i = 0; i < seq_len; ++i)
+		printf("%s%u,", i % 24 ? " " : "\n\t", seq[i]);
+	printf("\n};\n"
+	       "\n"
+	       "/** @brief Offset in @ref blk_sort_ops, by block size, location and rank */\n"
+	       "static const uint16_t blk_sort_index[%d][4][720] = {\n",
+	       BLK_SORT_MAX + 1);
+	for (size_t n = 2; n <= BLK_SORT_MAX; ++n) {
+		printf("\t[%zu] = {\n", n);
+		for (size_t dest = 0; dest < 4; ++dest) {
+			printf("\t\t[%s] = {", dest_names[dest]);
+			for (size_t rank = 0; rank < model_factorial(n); ++rank)
+				printf("%s%u,", rank % 16 ? " " : "\n\t\t\t", index[n][dest][rank]);
+			printf("\n\t\t},\n");
+		}
+		printf("\t},\n");
+	}
+	printf("};\n"
+	       "\n"
+	       "#endif // SORT_TABLES_H\n");
+	return 0;
+}